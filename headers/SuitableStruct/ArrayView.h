@@ -0,0 +1,150 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <type_traits>
+#include <SuitableStruct/Serializer.h>
+
+namespace SuitableStruct {
+
+// Read-only view of fundamental or enum items.
+// Loaded as a view into the source memory (see 'BufferReader'), which must outlive it.
+// If source memory isn't suitably aligned for 'T', items are copied into own storage.
+//
+// Data: uint64 count, uint8 padding, padding, items, 'alignof(T) - 1 - padding' trailing bytes.
+// Padding aligns items in the destination buffer; the total size doesn't depend on position.
+template<typename T>
+class ArrayView
+{
+    static_assert(std::is_fundamental_v<T> || std::is_enum_v<T>, "ArrayView supports only fundamental and enum items");
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    ArrayView() = default;
+    ArrayView(const T* data, size_t size) : m_data(data), m_size(size) { assert(data || !size); }
+
+    template<typename C,
+             typename std::enable_if_t<std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const C&>().data())>>, T>>* = nullptr>
+    ArrayView(const C& container) : m_data(container.data()), m_size(container.size()) { }
+
+    const T* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return !m_size; }
+
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+    const T& operator[](size_t index) const { assert(index < m_size); return m_data[index]; }
+
+    // True if items are copied instead of viewed (misaligned source)
+    bool isOwning() const { return static_cast<bool>(m_storage); }
+
+    bool operator==(const ArrayView& rhs) const { return m_size == rhs.m_size && std::equal(begin(), end(), rhs.begin()); }
+    bool operator!=(const ArrayView& rhs) const { return !(*this == rhs); }
+
+    static ArrayView fromCopy(const uint8_t* data, size_t size) {
+        auto storage = std::make_shared<std::vector<T>>(size);
+        if (size)
+            memcpy(storage->data(), data, size * sizeof(T));
+
+        ArrayView result(storage->data(), size);
+        result.m_storage = std::move(storage);
+        return result;
+    }
+
+private:
+    const T* m_data { nullptr };
+    size_t m_size { 0 };
+    std::shared_ptr<const std::vector<T>> m_storage;
+};
+
+template<typename T>
+struct SSPositionDependent<ArrayView<T>> : public std::bool_constant<(alignof(T) > 1)> { };
+
+template<typename T>
+void ssSaveImplTo(BufferWriter& writer, const ArrayView<T>& value)
+{
+    constexpr size_t alignment = alignof(T);
+
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+
+    const auto itemsPos = writer.offsetStart() + writer.position() + sizeof(uint8_t);
+    const auto padding = static_cast<uint8_t>((alignment - itemsPos % alignment) % alignment);
+    writer.write(padding);
+    writer.writeZeros(padding);
+    writer.writeRaw(value.data(), value.size() * sizeof(T));
+    writer.writeZeros(alignment - 1 - padding);
+}
+
+template<typename T>
+Buffer ssSaveImpl(const ArrayView<T>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename T>
+size_t ssSerializedSizeImpl(const ArrayView<T>& value)
+{
+    return Internal::ssLengthSize(value.size()) + sizeof(uint8_t) + (alignof(T) - 1) + value.size() * sizeof(T);
+}
+
+template<typename T>
+void ssLoadImpl(BufferReader& bufferReader, ArrayView<T>& value)
+{
+    constexpr size_t alignment = alignof(T);
+
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    uint8_t padding;
+    bufferReader.read(padding);
+
+    if (padding >= alignment)
+        Internal::throwFormat();
+
+    bufferReader.advance(padding);
+
+    if (sz > bufferReader.rest() / sizeof(T))
+        Internal::throwOutOfRange();
+
+    const auto data = bufferReader.data();
+    const auto size = static_cast<size_t>(sz);
+    bufferReader.advance(static_cast<std::ptrdiff_t>(size * sizeof(T)));
+    bufferReader.advance(static_cast<std::ptrdiff_t>(alignment - 1 - padding));
+
+    if (reinterpret_cast<uintptr_t>(data) % alignment == 0) {
+        value = ArrayView<T>(reinterpret_cast<const T*>(data), size);
+    } else {
+        value = ArrayView<T>::fromCopy(data, size);
+    }
+}
+
+template<typename T>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<ArrayView<T>>)
+{
+    constexpr size_t alignment = alignof(T);
+
+    const auto sz = Internal::ssReadLength(bufferReader);
+    const auto padding = bufferReader.read<uint8_t>();
+
+    if (padding >= alignment)
+        Internal::throwFormat();
+
+    bufferReader.advance(padding);
+
+    if (sz > bufferReader.rest() / sizeof(T))
+        Internal::throwOutOfRange();
+
+    bufferReader.advance(static_cast<std::ptrdiff_t>(sz * sizeof(T)));
+    bufferReader.advance(static_cast<std::ptrdiff_t>(alignment - 1 - padding));
+}
+
+} // namespace SuitableStruct
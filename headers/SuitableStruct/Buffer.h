@@ -4,6 +4,7 @@
 
 #pragma once
 #include <cstdint>
+#include <memory_resource>
 #include <type_traits>
 #include <SuitableStruct/Internals/LongSSO.h>
 
@@ -11,6 +12,11 @@
 class QByteArray;
 #endif
 
+// Inline capacity of 'Buffer', can be set with the CMake option of same name
+#ifndef SUITABLE_STRUCT_BUFFER_INLINE_CAPACITY
+#define SUITABLE_STRUCT_BUFFER_INLINE_CAPACITY 80
+#endif
+
 static_assert (sizeof(char) == sizeof(uint8_t), "Buffer constructor (const char*, size) is wrong!");
 
 namespace SuitableStruct {
@@ -18,10 +24,14 @@ namespace SuitableStruct {
 class Buffer
 {
 public:
+    // Data up to this size is stored in the object itself, see SUITABLE_STRUCT_BUFFER_INLINE_CAPACITY
+    static constexpr size_t InlineCapacity = SUITABLE_STRUCT_BUFFER_INLINE_CAPACITY;
+
     Buffer() = default;
-    Buffer(size_t size) { m_sso.allocate_copy(size); }
+    Buffer(size_t size) { writeZeros(size); }
     Buffer(const uint8_t* data, size_t size) { m_sso.allocate_copy(size, data); }
     Buffer(const char* data, size_t size): Buffer(reinterpret_cast<const uint8_t*>(data), size) {}
+    explicit Buffer(std::pmr::memory_resource* resource): m_sso(resource) {} // E.g. request-scoped arena
     Buffer(const Buffer& rhs) = default;
     Buffer(Buffer&& rhs) = default;
     ~Buffer() = default;
@@ -84,8 +94,14 @@ public:
     uint32_t hashLegacy() const;
     size_t size() const { return m_sso.size(); }
     void reduceSize(size_t amount) { m_sso.reduceSize(amount); }
+    void reserve(size_t capacity) { m_sso.reserve(capacity); }
+    size_t capacity() const { return m_sso.capacity(); }
+    void shrink_to_fit() { m_sso.shrink_to_fit(); }
+    void clear() { m_sso.clear(); } // Keeps capacity
 
+    // Appends 'sz' uninitialized bytes, to be filled by caller
     uint8_t* allocate(size_t sz) { return m_sso.allocate_copy(sz); }
+    std::pmr::memory_resource* memoryResource() const { return m_sso.memoryResource(); }
     const uint8_t* data() const { return m_sso.data(); }
     const uint8_t* cdata() const { return data(); }
     uint8_t* data() { return m_sso.data(); }
@@ -96,7 +112,7 @@ public:
 #endif
 
 private:
-    LongSSO<> m_sso;
+    LongSSO<InlineCapacity> m_sso;
 };
 
 } // namespace SuitableStruct
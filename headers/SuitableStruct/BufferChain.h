@@ -0,0 +1,63 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <SuitableStruct/Buffer.h>
+
+#if __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#define SUITABLE_STRUCT_HAS_IOVEC
+#endif
+
+namespace SuitableStruct {
+
+// Data split into refcounted chunks. Appending a chunk doesn't copy its bytes,
+// so large payloads can be referenced, and the whole chain sent with 'writev' / 'sendmsg'.
+class BufferChain
+{
+public:
+    struct Chunk
+    {
+        const uint8_t* data { nullptr };
+        size_t size { 0 };
+        std::shared_ptr<const void> owner; // Keeps [data, data + size) alive
+    };
+
+    BufferChain() = default;
+    explicit BufferChain(Buffer&& buffer) { append(std::move(buffer)); }
+
+    bool operator== (const BufferChain& rhs) const;
+    bool operator!= (const BufferChain& rhs) const { return !(*this == rhs); }
+    bool operator== (const Buffer& rhs) const;
+    bool operator!= (const Buffer& rhs) const { return !(*this == rhs); }
+
+    void append(const Buffer& buffer) { append(Buffer(buffer)); }
+    void append(Buffer&& buffer);
+    void append(const BufferChain& chain);
+    void appendShared(const uint8_t* data, size_t size, std::shared_ptr<const void> owner);
+    void appendShared(std::shared_ptr<const Buffer> buffer);
+    void clear();
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const std::vector<Chunk>& chunks() const { return m_chunks; }
+
+    uint32_t hash() const;
+    Buffer toBuffer() const;
+
+#ifdef SUITABLE_STRUCT_HAS_IOVEC
+    // Make sure lifetime of 'BufferChain' is greater than returned iovecs'.
+    std::vector<iovec> iovecs() const;
+#endif
+
+private:
+    std::vector<Chunk> m_chunks;
+    size_t m_size { 0 };
+};
+
+} // namespace SuitableStruct
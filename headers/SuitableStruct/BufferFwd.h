@@ -6,5 +6,7 @@
 
 namespace SuitableStruct {
 class Buffer;
+class BufferChain;
 class BufferReader;
+class BufferWriter;
 } // namespace SuitableStruct
@@ -20,34 +20,32 @@ public:
                  std::optional<size_t> optOffsetStart = {},
                  std::optional<size_t> optLen = {},
                  std::optional<size_t> optOffsetEnd = {})
-        : m_buffer(buffer)
+        : m_buffer(&buffer)
     {
-        assert((!optLen && !optOffsetEnd) ||
-               (optLen.has_value() ^ optOffsetEnd.has_value()));
-
-        m_offsetStart = optOffsetStart.value_or(0);
-        assert(m_offsetStart <= buffer.size());
-
-        if (optLen) {
-            m_optOffsetEnd = m_offsetStart + *optLen;
-            assert(m_optOffsetEnd.value() <= buffer.size());
-        } else if (optOffsetEnd) {
-            m_optOffsetEnd = optOffsetEnd;
-            assert(m_optOffsetEnd.value() <= buffer.size());
-        }
-
-        if (m_optOffsetEnd)
-            assert(m_offsetStart <= m_optOffsetEnd.value());
+        init(optOffsetStart, optLen, optOffsetEnd);
+    }
 
-        assert(position() <= size());
+    // Reads non-owned memory, e.g. memory-mapped file (see 'MappedFile').
+    // Make sure lifetime of 'data' is greater than 'BufferReader's.
+    BufferReader(const uint8_t* data, size_t sz,
+                 std::optional<size_t> optOffsetStart = {},
+                 std::optional<size_t> optLen = {},
+                 std::optional<size_t> optOffsetEnd = {})
+        : m_rawData(data),
+          m_rawSize(sz)
+    {
+        assert(data || !sz);
+        init(optOffsetStart, optLen, optOffsetEnd);
     }
 
-    const Buffer& bufferSrc() const { return m_buffer; }
+    // Available only if reader is constructed over 'Buffer'
+    bool hasBufferSrc() const { return m_buffer; }
+    const Buffer& bufferSrc() const { assert(m_buffer); return *m_buffer; }
     Buffer bufferMapped() const { return Buffer(cdataSrc(), size()); }
     Buffer bufferRest() const { return Buffer(cdata(), rest()); }
 
     size_t offsetStart() const { return m_offsetStart; }
-    size_t offsetEnd() const { return m_optOffsetEnd.value_or(m_buffer.size()); }
+    size_t offsetEnd() const { return m_optOffsetEnd.value_or(srcSize()); }
 
     size_t size() const { return offsetEnd() - offsetStart(); }
     size_t position() const { return m_position; }
@@ -57,10 +55,10 @@ public:
     size_t advance(std::ptrdiff_t delta) { checkAdvance(delta); return seek(m_position + delta); }
     void resetPosition() { m_position = 0; }
 
-    const uint8_t* dataSrc() const { return m_buffer.data() + m_offsetStart; }
+    const uint8_t* dataSrc() const { return srcData() + m_offsetStart; }
     const uint8_t* cdataSrc() const { return dataSrc(); }
 
-    const uint8_t* data() const { return m_buffer.data() + m_offsetStart + m_position; }
+    const uint8_t* data() const { return srcData() + m_offsetStart + m_position; }
     const uint8_t* cdata() const { return data(); }
 
     uint32_t hash() const;
@@ -73,7 +71,10 @@ public:
 
     BufferReader readRaw(size_t sz) {
         checkAdvance(sz);
-        const BufferReader result(m_buffer, m_offsetStart + m_position, sz);
+        BufferReader result(*this);
+        result.m_offsetStart = m_offsetStart + m_position;
+        result.m_optOffsetEnd = result.m_offsetStart + sz;
+        result.m_position = 0;
         advance(sz);
         return result;
     }
@@ -82,6 +83,19 @@ public:
              typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
     void read(T& data) { readRaw(&data, sizeof(data)); }
 
+    // LEB128, see 'BufferWriter::writeVarint'. Single byte values take the inline path.
+    uint64_t readVarint() {
+        if (m_position < size()) {
+            const auto byte = *data();
+            if (byte < 0x80) {
+                m_position++;
+                return byte;
+            }
+        }
+
+        return readVarintSlow();
+    }
+
     template<typename T,
              typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
     T read() {
@@ -91,14 +105,46 @@ public:
     }
 
 private:
+    void init(std::optional<size_t> optOffsetStart,
+              std::optional<size_t> optLen,
+              std::optional<size_t> optOffsetEnd)
+    {
+        assert((!optLen && !optOffsetEnd) ||
+               (optLen.has_value() ^ optOffsetEnd.has_value()));
+
+        m_offsetStart = optOffsetStart.value_or(0);
+        assert(m_offsetStart <= srcSize());
+
+        if (optLen) {
+            m_optOffsetEnd = m_offsetStart + *optLen;
+            assert(m_optOffsetEnd.value() <= srcSize());
+        } else if (optOffsetEnd) {
+            m_optOffsetEnd = optOffsetEnd;
+            assert(m_optOffsetEnd.value() <= srcSize());
+        }
+
+        if (m_optOffsetEnd)
+            assert(m_offsetStart <= m_optOffsetEnd.value());
+
+        assert(position() <= size());
+    }
+
+    // Buffer is queried each time, so reader stays valid if it's reallocated
+    const uint8_t* srcData() const { return m_buffer ? m_buffer->data() : m_rawData; }
+    size_t srcSize() const { return m_buffer ? m_buffer->size() : m_rawSize; }
+
+    uint64_t readVarintSlow();
+
     void checkPosition(size_t pos) const;
     void checkAdvance(size_t delta) const;
     void checkAdvance(std::ptrdiff_t delta) const;
 
 private:
-    const Buffer& m_buffer;
+    const Buffer* m_buffer { nullptr };
+    const uint8_t* m_rawData { nullptr };
+    size_t m_rawSize { 0 };
     size_t m_position { 0 };
-    size_t m_offsetStart;
+    size_t m_offsetStart { 0 };
     std::optional<size_t> m_optOffsetEnd;
 };
 
@@ -0,0 +1,182 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <SuitableStruct/Buffer.h>
+#include <SuitableStruct/BufferChain.h>
+
+namespace SuitableStruct {
+
+// Append-only sink over a 'Buffer'. All positions are relative to the size
+// the buffer had when the writer was created, so already written bytes
+// (sizes, counters, hashes) can be patched in place after the payload is known.
+//
+// In chain mode, shared payloads of at least 'sharedThreshold' bytes are referenced
+// instead of being copied into 'buffer'; the result is taken with 'takeChain'.
+// Positions stay logical, i.e. include referenced bytes.
+class BufferWriter
+{
+public:
+    static constexpr size_t DefaultSharedThreshold = 4096;
+
+    // Make sure lifetime of 'buffer' is greater than 'BufferWriter's.
+    explicit BufferWriter(Buffer& buffer)
+        : m_buffer(buffer),
+          m_offsetStart(buffer.size())
+    { }
+
+    // Chain mode
+    BufferWriter(Buffer& buffer, size_t sharedThreshold)
+        : m_buffer(buffer),
+          m_offsetStart(buffer.size()),
+          m_sharedThreshold(sharedThreshold)
+    { }
+
+    BufferWriter(const BufferWriter&) = delete;
+    BufferWriter& operator=(const BufferWriter&) = delete;
+
+    Buffer& bufferDst() { return m_buffer; }
+    const Buffer& bufferDst() const { return m_buffer; }
+
+    size_t offsetStart() const { return m_offsetStart; }
+    size_t position() const { return m_buffer.size() - m_offsetStart + m_sharedSize; }
+
+    // Not available for referenced bytes
+    const uint8_t* data(size_t pos = 0) const { return m_buffer.cdata() + bufferPosition(pos, 0); }
+    const uint8_t* cdata(size_t pos = 0) const { return data(pos); }
+
+    uint32_t hash(size_t pos, size_t sz) const;
+
+    // Calls 'func(const uint8_t* data, size_t size)' for consecutive parts of [pos, pos + sz)
+    template<typename Func>
+    void forEachPart(size_t pos, size_t sz, Func&& func) const {
+        checkRange(pos, sz);
+
+        if (m_shared.empty()) {
+            func(m_buffer.cdata() + m_offsetStart + pos, sz);
+            return;
+        }
+
+        forEachPartChained(pos, sz, [&func](const uint8_t* data, size_t size) { func(data, size); });
+    }
+
+    bool isChained() const { return m_sharedThreshold != NotChained; }
+    size_t sharedThreshold() const { return m_sharedThreshold; }
+
+    // Chain mode: references [ptr, ptr + sz) kept alive by 'owner' if it's large enough, otherwise copies it
+    void writeShared(const void* ptr, size_t sz, const std::shared_ptr<const void>& owner) {
+        if (sz < m_sharedThreshold || !owner) {
+            writeRaw(ptr, sz);
+            return;
+        }
+
+        appendShared(static_cast<const uint8_t*>(ptr), sz, owner);
+    }
+
+    // Chain mode: whole destination buffer (including data before 'offsetStart') with referenced parts.
+    // Destination buffer is moved into the chain and left empty.
+    [[nodiscard]] BufferChain takeChain();
+
+    void write(const Buffer& buffer) { m_buffer.write(buffer); }
+    void write(Buffer&& buffer) { m_buffer.write(std::move(buffer)); }
+
+    template<typename T,
+             typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
+    void write(const T& data) { writeRaw(&data, sizeof(data)); }
+
+    void writeRaw(const void* ptr, size_t sz) { m_buffer.writeRaw(ptr, sz); }
+    void writeZeros(size_t sz) { m_buffer.writeZeros(sz); }
+    uint8_t* allocate(size_t sz) { return m_buffer.allocate(sz); }
+
+    // Writes zero-initialized room for 'T' and returns its position for a later 'patch'
+    template<typename T,
+             typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
+    [[nodiscard]] size_t writePlaceholder() {
+        const auto pos = position();
+        writeZeros(sizeof(T));
+        return pos;
+    }
+
+    template<typename T,
+             typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
+    void patch(size_t pos, const T& value) {
+        memcpy(m_buffer.data() + bufferPosition(pos, sizeof(value)), &value, sizeof(value));
+    }
+
+    // LEB128: 7 bits per byte, high bit set on all bytes but the last
+    static constexpr size_t MaxVarintSize = 10;
+
+    static constexpr size_t varintSize(uint64_t value) {
+        size_t result = 1;
+        while (value >= 0x80) {
+            value >>= 7;
+            result++;
+        }
+        return result;
+    }
+
+    void writeVarint(uint64_t value) {
+        if (value < 0x80) {
+            write(static_cast<uint8_t>(value));
+            return;
+        }
+
+        uint8_t bytes[MaxVarintSize];
+        writeRaw(bytes, encodeVarint(bytes, value));
+    }
+
+private:
+    static size_t encodeVarint(uint8_t* dst, uint64_t value) {
+        size_t sz = 0;
+        while (value >= 0x80) {
+            dst[sz++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        dst[sz++] = static_cast<uint8_t>(value);
+        return sz;
+    }
+
+    void checkRange(size_t pos, size_t sz) const;
+
+    // Position of [pos, pos + sz) in 'm_buffer', throws if it overlaps referenced bytes
+    size_t bufferPosition(size_t pos, size_t sz) const {
+        if (m_shared.empty()) {
+            checkRange(pos, sz);
+            return m_offsetStart + pos;
+        }
+
+        return bufferPositionChained(pos, sz);
+    }
+
+    size_t bufferPositionChained(size_t pos, size_t sz) const;
+    void forEachPartChained(size_t pos, size_t sz, const std::function<void(const uint8_t*, size_t)>& func) const;
+    void appendShared(const uint8_t* data, size_t sz, const std::shared_ptr<const void>& owner);
+
+private:
+    static constexpr size_t NotChained = std::numeric_limits<size_t>::max();
+
+    struct SharedPart
+    {
+        size_t position;     // Logical position
+        size_t sharedBefore; // Referenced bytes before this part
+        BufferChain::Chunk chunk;
+    };
+
+    Buffer& m_buffer;
+    size_t m_offsetStart;
+    size_t m_sharedThreshold { NotChained };
+    size_t m_sharedSize { 0 };
+    std::vector<SharedPart> m_shared;
+};
+
+} // namespace SuitableStruct
@@ -11,3 +11,6 @@ struct SuitableStruct::ContainerInserter<std::array<Arg,N>> { static auto get(st
 
 template<typename Arg, size_t N>
 struct SuitableStruct::IsContainer<std::array<Arg, N>> : public std::true_type { };
+
+template<typename Arg, size_t N>
+struct SuitableStruct::IsContiguousContainer<std::array<Arg, N>> : public std::true_type { };
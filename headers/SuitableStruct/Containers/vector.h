@@ -7,3 +7,6 @@
 #include <vector>
 
 template<typename... Args> struct SuitableStruct::IsContainer<std::vector<Args...>> : public std::true_type { };
+
+template<typename Arg, typename Alloc>
+struct SuitableStruct::IsContiguousContainer<std::vector<Arg, Alloc>> : public std::bool_constant<!std::is_same_v<Arg, bool>> { };
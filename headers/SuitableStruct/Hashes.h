@@ -20,8 +20,14 @@ uint32_t ssHash(const T& value);
 // ssHash. Tools
 uint32_t ssHashRaw_F0(const void* ptr, size_t sz); // Legacy
 uint32_t ssHashRaw_F1(const void* ptr, size_t sz);
+uint32_t ssHashRaw_F2(const void* ptr, size_t sz); // CRC32C, uses SSE4.2 / ARMv8 CRC instructions when available
 uint32_t ssHashRaw(const void* ptr, size_t sz);
 
+// Continue 'hash' of preceding bytes with next [ptr, ptr + sz), e.g. for data split into chunks:
+// ssHashRawContinue_F1(ssHashRaw_F1(a, aSz), b, bSz) == hash of 'a' and 'b' joined together
+uint32_t ssHashRawContinue_F1(uint32_t hash, const void* ptr, size_t sz);
+uint32_t ssHashRawContinue_F2(uint32_t hash, const void* ptr, size_t sz);
+
 namespace Internal {
 
 // Smart pointer hash implementations - hash the content, not the pointer
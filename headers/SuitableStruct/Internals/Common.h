@@ -10,12 +10,16 @@
 namespace SuitableStruct {
 
 enum class SSDataFormat {
-    F0,
-    F1
+    F0, // Single-version, legacy hash
+    F1, // Multiple versions segments, FNV-1a hash
+    F2, // F1 payload, CRC32C hash
+    F3, // Compact: F1 payload with varint lengths, segment sizes & integers, CRC32C hash
+    F4  // Indexed: F1 payload with chunk index in large containers (see 'SSParallelLoad'), CRC32C hash
 };
 
 enum class SSLoadMode {
     Protected,
+    ProtectedTrusted, // Envelope is parsed, but hash isn't checked. For self-produced data, see 'ssVerify'
     NonProtectedDefault,
     NonProtectedF0Hint,
     NonProtectedF1Hint
@@ -23,6 +27,22 @@ enum class SSLoadMode {
 
 template<typename T> struct IsContainer : public std::false_type { };
 
+// Selects overloads by type where no object exists, e.g. 'ssValidateImpl'
+template<typename T> struct SSTypeTag { };
+
+// Containers with 'data()' and 'resize()' storing items in one memory block.
+// Fundamental and enum items of such containers are saved & loaded by a single memcpy.
+template<typename T> struct IsContiguousContainer : public std::false_type { };
+
+// Opt-in: containers of 'T' write segments count, versions & sizes once for all items,
+// followed by payloads of all items per version. Changes wire format of such containers.
+// All versions of 'T' must be serialized by non-empty 'ssTuple' and be copyable if downgraded.
+template<typename T> struct SSHoistFraming : public std::false_type { };
+
+// Data of 'T' depends on its absolute position in the output (e.g. alignment padding), so containers
+// of types including 'T' aren't saved by chunks in separate buffers (see 'SSParallelSave').
+template<typename T> struct SSPositionDependent : public std::false_type { };
+
 template<typename T, typename std::enable_if<can_size<T>::value>::type* = nullptr>
 size_t containerSize(const T& container) { return container.size(); }
 
@@ -35,4 +55,14 @@ struct ContainerInserter { static auto get(T& x) { return std::back_inserter(x);
 template<typename T>
 struct ContainerItemType { using type = typename T::value_type; };
 
+// Pre-allocates room for 'count' items before loading (vectors, strings, hash-based containers...)
+template<typename T>
+struct ContainerReserver
+{
+    static void reserve(T& x, size_t count) {
+        if constexpr (can_reserve<T, size_t>::value)
+            x.reserve(count);
+    }
+};
+
 } // namespace SuitableStruct
@@ -6,16 +6,27 @@
 #include <type_traits>
 #include <limits>
 #include <cstdint>
+#include <algorithm>
 #include <chrono>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <memory_resource>
 #include <memory>
 #include <variant>
+#include <tuple>
+#include <mutex>
+#include <vector>
+#include <iterator>
+#include <cstddef>
 
 #include <SuitableStruct/Internals/Common.h>
 #include <SuitableStruct/Internals/FwdDeclarations.h>
 #include <SuitableStruct/BufferReader.h>
+#include <SuitableStruct/BufferWriter.h>
 #include <SuitableStruct/Internals/Helpers.h>
+#include <SuitableStruct/Internals/SegmentSizes.h>
+#include <SuitableStruct/Internals/Version.h>
 #include <SuitableStruct/Exceptions.h>
 #include <SuitableStruct/Handlers.h>
 
@@ -51,30 +62,387 @@ namespace Helpers {
 #endif // SUITABLE_STRUCT_HAS_QT_LIBRARY
 } // namespace Helpers
 
+// Default types are written straight into 'BufferWriter' by 'ssSaveImplTo'.
+// 'Buffer ssSaveImpl(...)' overloads are kept as thin wrappers for custom handlers.
+template<typename T>
+Buffer ssSaveImplViaWriter(const T& value)
+{
+    Buffer result;
+    BufferWriter writer(result);
+    ssSaveImplTo(writer, value);
+    return result;
+}
+
+// ------ Compact format (F3) ------
+// Lengths, segment sizes and integers wider than one byte are written as LEB128 varints,
+// signed integers are zigzag-encoded. Everything else is the same as in F1.
+namespace Internal {
+
+template<typename T>
+constexpr bool IsVarintType_v = std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) > 1);
+
+template<typename T>
+uint64_t ssVarintEncode(T value)
+{
+    if constexpr (std::is_signed_v<T>) {
+        const auto x = static_cast<int64_t>(value);
+        return (static_cast<uint64_t>(x) << 1) ^ (x < 0 ? ~uint64_t{} : uint64_t{});
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template<typename T>
+T ssVarintDecode(uint64_t raw)
+{
+    if constexpr (std::is_signed_v<T>) {
+        const auto x = static_cast<int64_t>((raw >> 1) ^ (~(raw & 1) + 1));
+        if (x < std::numeric_limits<T>::min() || x > std::numeric_limits<T>::max())
+            throwFormat();
+        return static_cast<T>(x);
+    } else {
+        if (raw > std::numeric_limits<T>::max())
+            throwFormat();
+        return static_cast<T>(raw);
+    }
+}
+
+// Container & string lengths, segment sizes
+inline void ssWriteLength(BufferWriter& writer, uint64_t length)
+{
+    if (isCompactFormat()) {
+        writer.writeVarint(length);
+    } else {
+        writer.write(length);
+    }
+}
+
+inline uint64_t ssReadLength(BufferReader& bufferReader)
+{
+    return isCompactFormat() ? bufferReader.readVarint() : bufferReader.read<uint64_t>();
+}
+
+inline size_t ssLengthSize(uint64_t length)
+{
+    return isCompactFormat() ? BufferWriter::varintSize(length) : sizeof(uint64_t);
+}
+
+// Bytes of 'object' (string, bytes container). Referenced instead of copied by chained writer,
+// if 'object' is kept alive by 'std::shared_ptr' being saved.
+inline void ssWriteBytesOf(BufferWriter& writer, const void* object, const void* data, size_t size)
+{
+    if (writer.isChained()) {
+        if (const auto owner = sharedPayloadOwner(object)) {
+            writer.writeShared(data, size, *owner);
+            return;
+        }
+    }
+
+    writer.writeRaw(data, size);
+}
+
+// Moves 'bufferReader' past a fundamental or enum value
+template<typename T>
+void ssSkipPrimitive(BufferReader& bufferReader)
+{
+    static_assert(std::is_fundamental_v<T> || std::is_enum_v<T>, "Non-class types are expected to be fundamental or enum");
+
+    if constexpr (IsVarintType_v<T>) {
+        if (isCompactFormat()) {
+            (void)bufferReader.readVarint();
+            return;
+        }
+    }
+
+    bufferReader.readRaw(sizeof(T));
+}
+
+} // namespace Internal
+
+// ------ Validation ------
+// 'ssValidateImpl(BufferReader&, SSTypeTag<T>)' walks data of 'T' without constructing it,
+// see 'ssValidate'. Class types are framed by 'ssValidateInternal'.
+namespace Internal {
+
+// Flag of optional and pointers
+inline bool ssValidateFlag(BufferReader& bufferReader)
+{
+    const auto flag = bufferReader.read<uint8_t>();
+
+    if (flag > 1)
+        throwFormat();
+
+    return flag;
+}
+
+// Size-prefixed bytes: strings, byte arrays
+inline void ssValidateBytes(BufferReader& bufferReader)
+{
+    const auto sz = ssReadLength(bufferReader);
+
+    if (sz > bufferReader.rest())
+        throwOutOfRange();
+
+    bufferReader.advance(static_cast<std::ptrdiff_t>(sz));
+}
+
+template<typename T>
+void ssValidateItems(BufferReader& bufferReader, uint64_t count)
+{
+    if constexpr (!std::is_class_v<T>) {
+        if (!IsVarintType_v<T> || !isCompactFormat()) {
+            // No framing, just check bounds
+            if (count > bufferReader.rest() / sizeof(T))
+                throwOutOfRange();
+
+            bufferReader.advance(static_cast<std::ptrdiff_t>(count * sizeof(T)));
+            return;
+        }
+    }
+
+    // Each item takes at least one byte, so corrupted count fails on bounds check
+    for (uint64_t i = 0; i < count; i++)
+        ssValidateInternal<T>(bufferReader);
+}
+
+} // namespace Internal
+
+namespace Internal {
+// Framing of a class instance with one segment: segments count, version, uint64 size
+constexpr size_t SS_SINGLE_SEGMENT_FRAMING_SIZE = sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t);
+
+// Same, for current format (see 'isCompactFormat')
+inline size_t ssSingleSegmentFramingSize(size_t payloadSize)
+{
+    return sizeof(uint8_t) + sizeof(uint8_t) + ssLengthSize(payloadSize);
+}
+} // namespace Internal
+
+// ------ Chunk index ------
+// Format F4 writes containers of 'IsIndexedItem_v' items (after items count) as:
+//   varint grain (0: no index, items follow), uint64 end offset of each chunk of 'grain' items
+//   (relative to the first item), items.
+// Chunks can be loaded independently, item 'i' is found by skipping at most 'grain - 1' items.
+namespace Internal {
+
+// Variable-sized class items. Fixed-sized ones are found by their size, hoisted ones are stored by columns.
+template<typename T>
+constexpr bool IsIndexedItem_v = std::is_class_v<T> && !SSFixedSize<T>::value && !SSHoistFraming<T>::value;
+
+// Items per chunk: grain of current parallel save, so each chunk is saved by a single task
+inline size_t ssIndexGrain()
+{
+    const auto& options = currentParallelSave();
+    return std::max<size_t>(options ? options->grain : SSParallelSave{}.grain, 1);
+}
+
+// Index size of a container of 'count' items
+inline size_t ssIndexSize(size_t count)
+{
+    const auto grain = ssIndexGrain();
+    if (count <= grain)
+        return 1;
+
+    return BufferWriter::varintSize(grain) + (count + grain - 1) / grain * sizeof(uint64_t);
+}
+
+struct ItemsIndex
+{
+    uint64_t grain {}; // 0: no index
+    std::vector<uint64_t> chunkEnds;
+
+    size_t chunksCount() const { return chunkEnds.size(); }
+    uint64_t itemsSize() const { return chunkEnds.empty() ? 0 : chunkEnds.back(); }
+    uint64_t chunkBegin(size_t chunk) const { return chunk ? chunkEnds[chunk - 1] : 0; }
+    uint64_t chunkItems(size_t chunk, uint64_t count) const { return std::min(grain, count - chunk * grain); }
+
+    // Data of 'chunk', 'items' starts at the first item
+    BufferReader chunkData(const BufferReader& items, size_t chunk) const {
+        BufferReader reader(items);
+        reader.seek(static_cast<size_t>(chunkBegin(chunk)));
+        return reader.readRaw(static_cast<size_t>(chunkEnds[chunk] - chunkBegin(chunk)));
+    }
+};
+
+// Reads index of 'count' items. Offsets are checked to be ordered and within the rest of input.
+ItemsIndex ssReadItemsIndex(BufferReader& bufferReader, uint64_t count);
+
+} // namespace Internal
+// ------ ------
+
+// ------ Position dependence ------
+// Types saved as part of 'T' by default serializers ('ssTuple' members are found separately)
+template<typename T, typename = void>
+struct SSNestedTypes { using type = std::tuple<>; };
+
+template<typename T>
+struct SSNestedTypes<T, std::enable_if_t<IsContainer<T>::value>> { using type = std::tuple<typename ContainerItemType<T>::type>; };
+
+template<typename T> struct SSNestedTypes<std::optional<T>> { using type = std::tuple<T>; };
+template<typename T> struct SSNestedTypes<std::shared_ptr<T>> { using type = std::tuple<T>; };
+template<typename T> struct SSNestedTypes<std::unique_ptr<T>> { using type = std::tuple<T>; };
+template<typename T1, typename T2> struct SSNestedTypes<std::pair<T1, T2>> { using type = std::tuple<T1, T2>; };
+template<typename... Ts> struct SSNestedTypes<std::tuple<Ts...>> { using type = std::tuple<Ts...>; };
+template<typename... Ts> struct SSNestedTypes<std::variant<Ts...>> { using type = std::tuple<Ts...>; };
+
+namespace Internal {
+
+template<typename T, typename... Visited>
+constexpr bool ssIsPositionDependent();
+
+// Any of 'Tuple' types
+template<typename Tuple, typename... Visited>
+struct SSAnyPositionDependent;
+
+template<typename... Ts, typename... Visited>
+struct SSAnyPositionDependent<std::tuple<Ts...>, Visited...>
+    : std::bool_constant<(ssIsPositionDependent<Ts, Visited...>() || ...)> {};
+
+// 'ssTuple' members of T, none for custom savers
+template<typename T, typename = void>
+struct SSMemberTypes { using type = std::tuple<>; };
+
+template<typename T>
+struct SSMemberTypes<T, std::enable_if_t<can_ssTuple<T>::value && !can_ssSaveImpl<T>::value && !Handlers<T>::value>>
+{
+    using type = decltype(std::declval<const T&>().ssTuple());
+};
+
+// Any member of any of 'Versions' (older versions are saved as downgraded segments)
+template<typename Versions, typename... Visited>
+struct SSAnyMemberPositionDependent;
+
+template<typename... Vs, typename... Visited>
+struct SSAnyMemberPositionDependent<std::tuple<Vs...>, Visited...>
+    : std::bool_constant<(SSAnyPositionDependent<typename SSMemberTypes<Vs>::type, Vs..., Visited...>::value || ...)> {};
+
+// Whether 'T' includes data of 'SSPositionDependent' types. Custom savers make payload in own buffer.
+// 'Visited' stops recursion of self-referencing types, e.g. trees.
+template<typename T, typename... Visited>
+constexpr bool ssIsPositionDependent()
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    if constexpr ((std::is_same_v<U, Visited> || ...)) {
+        return false;
+    } else if constexpr (SSPositionDependent<U>::value) {
+        return true;
+    } else if constexpr (can_ssSaveImpl<U>::value || Handlers<U>::value) {
+        return false;
+    } else if constexpr (can_ssTuple<U>::value) {
+        return SSAnyMemberPositionDependent<SSVersions_t<U>, U, Visited...>::value;
+    } else {
+        return SSAnyPositionDependent<typename SSNestedTypes<U>::type, U, Visited...>::value;
+    }
+}
+
+} // namespace Internal
+// ------ ------
+
+// Size of 'ssSaveImpl' payload (no segment framing) for default types with fixed layout.
+// Types without specialization are measured by 'ssSerializedSizeImpl' at runtime.
+template<typename T, typename = void>
+struct SSFixedImplSize
+{
+    static constexpr std::optional<size_t> value {};
+};
+
+// Sum of framed fixed sizes, 'nullopt' if any of 'Ts' is variable-sized
+template<typename... Ts>
+constexpr std::optional<size_t> ssFixedSizeSum()
+{
+    if constexpr ((ssFixedSizeInternal<std::decay_t<Ts>>().has_value() && ...)) {
+        return (size_t{} + ... + *ssFixedSizeInternal<std::decay_t<Ts>>());
+    } else {
+        return {};
+    }
+}
+
+template<typename T,
+         typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
+void ssSaveImplTo(BufferWriter& writer, T value)
+{
+    if constexpr (Internal::IsVarintType_v<T>) {
+        if (Internal::isCompactFormat()) {
+            writer.writeVarint(Internal::ssVarintEncode(value));
+            return;
+        }
+    }
+
+    writer.write(value);
+}
+
 template<typename T,
          typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
 Buffer ssSaveImpl(T value)
 {
+    if constexpr (Internal::IsVarintType_v<T>) {
+        if (Internal::isCompactFormat())
+            return ssSaveImplViaWriter(value);
+    }
+
     return Buffer::fromValue(value);
 }
 
+template<typename T>
+struct SSFixedImplSize<T, std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>>
+{
+    static constexpr std::optional<size_t> value = sizeof(T);
+};
+
+template<typename T,
+         typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
+size_t ssSerializedSizeImpl(T value)
+{
+    if constexpr (Internal::IsVarintType_v<T>) {
+        if (Internal::isCompactFormat())
+            return BufferWriter::varintSize(Internal::ssVarintEncode(value));
+    }
+
+    (void)value;
+    return sizeof(T);
+}
+
 template<typename T,
          typename std::enable_if_t<std::is_fundamental_v<T> || std::is_enum_v<T>>* = nullptr>
 void ssLoadImpl(BufferReader& bufferReader, T& value)
 {
+    if constexpr (Internal::IsVarintType_v<T>) {
+        if (Internal::isCompactFormat()) {
+            value = Internal::ssVarintDecode<T>(bufferReader.readVarint());
+            return;
+        }
+    }
+
     bufferReader.read(value);
 }
 
 template<typename T>
-Buffer ssSaveImpl(const std::optional<T>& value)
+void ssSaveImplTo(BufferWriter& writer, const std::optional<T>& value)
 {
-    Buffer result;
-    result.write(value.has_value());
+    writer.write(value.has_value());
 
     if (value.has_value())
-        result += ssSaveInternal(value.value());
+        ssSaveInternal(writer, value.value());
+}
 
-    return result;
+template<typename T>
+Buffer ssSaveImpl(const std::optional<T>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename T>
+size_t ssSerializedSizeImpl(const std::optional<T>& value)
+{
+    return sizeof(bool) + (value.has_value() ? ssSerializedSizeInternal(value.value()) : 0);
+}
+
+template<typename T>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::optional<T>>)
+{
+    if (Internal::ssValidateFlag(bufferReader))
+        ssValidateInternal<T>(bufferReader);
 }
 
 template<typename T>
@@ -84,32 +452,60 @@ void ssLoadImpl(BufferReader& bufferReader, std::optional<T>& value)
     ssLoadImpl(bufferReader, hasValue);
 
     if (hasValue) {
-        value.emplace();
+        if (!value.has_value() || !Internal::isLoadingInPlace())
+            value.emplace();
         ssLoadInternal(bufferReader, *value);
     } else { // Just precaution
         value.reset();
     }
 }
 
+inline void ssSaveImplTo(BufferWriter& /*writer*/, const std::monostate& /*value*/)
+{ }
+
 inline Buffer ssSaveImpl(const std::monostate& /*value*/)
 {
     return {};
 }
 
+template<>
+struct SSFixedImplSize<std::monostate>
+{
+    static constexpr std::optional<size_t> value = 0;
+};
+
+inline size_t ssSerializedSizeImpl(const std::monostate& /*value*/)
+{
+    return 0;
+}
+
+inline void ssValidateImpl(BufferReader& /*bufferReader*/, SSTypeTag<std::monostate>)
+{
+}
+
 inline void ssLoadImpl(BufferReader& /*bufferReader*/, std::monostate& /*value*/)
 { }
 
 template<typename... Ts>
-Buffer ssSaveImpl(const std::variant<Ts...>& value)
+void ssSaveImplTo(BufferWriter& writer, const std::variant<Ts...>& value)
 {
     static_assert(sizeof...(Ts) <= std::numeric_limits<uint8_t>::max(), "std::variant with more than 255 alternatives is not supported");
 
-    Buffer result;
-    result.write(static_cast<uint8_t>(value.index()));
+    writer.write(static_cast<uint8_t>(value.index()));
 
-    std::visit([&result](const auto& x){ result += ssSaveInternal(x); }, value);
+    std::visit([&writer](const auto& x){ ssSaveInternal(writer, x); }, value);
+}
 
-    return result;
+template<typename... Ts>
+Buffer ssSaveImpl(const std::variant<Ts...>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename... Ts>
+size_t ssSerializedSizeImpl(const std::variant<Ts...>& value)
+{
+    return sizeof(uint8_t) + std::visit([](const auto& x){ return ssSerializedSizeInternal(x); }, value);
 }
 
 template<size_t I, typename... Ts>
@@ -117,7 +513,11 @@ void ssLoadImplVariant(BufferReader& bufferReader, std::variant<Ts...>& value, u
 {
     if constexpr (I < sizeof...(Ts)) {
         if (I == readIndex) {
-            value = ssLoadInternalRet<std::variant_alternative_t<I, std::variant<Ts...>>>(bufferReader);
+            if (value.index() == I && Internal::isLoadingInPlace()) {
+                ssLoadInternal(bufferReader, std::get<I>(value));
+            } else {
+                value = ssLoadInternalRet<std::variant_alternative_t<I, std::variant<Ts...>>>(bufferReader);
+            }
 
         } else {
             ssLoadImplVariant<I + 1>(bufferReader, value, readIndex);
@@ -134,17 +534,67 @@ void ssLoadImpl(BufferReader& bufferReader, std::variant<Ts...>& value)
 
     uint8_t index {};
     bufferReader.read(index);
-    assert(index < sizeof...(Ts));
+
+    if (index >= sizeof...(Ts))
+        Internal::throwFormat();
+
     ssLoadImplVariant<0>(bufferReader, value, index);
 }
 
+template<size_t I, typename... Ts>
+void ssValidateImplVariant(BufferReader& bufferReader, uint8_t readIndex)
+{
+    if constexpr (I < sizeof...(Ts)) {
+        if (I == readIndex) {
+            ssValidateInternal<std::variant_alternative_t<I, std::variant<Ts...>>>(bufferReader);
+        } else {
+            ssValidateImplVariant<I + 1, Ts...>(bufferReader, readIndex);
+        }
+    }
+}
+
+template<typename... Ts>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::variant<Ts...>>)
+{
+    const auto index = bufferReader.read<uint8_t>();
+
+    if (index >= sizeof...(Ts))
+        Internal::throwFormat();
+
+    ssValidateImplVariant<0, Ts...>(bufferReader, index);
+}
+
+template<typename T1, typename T2>
+void ssSaveImplTo(BufferWriter& writer, const std::pair<T1, T2>& value)
+{
+    ssSaveInternal(writer, value.first);
+    ssSaveInternal(writer, value.second);
+}
+
 template<typename T1, typename T2>
 Buffer ssSaveImpl(const std::pair<T1, T2>& value)
 {
-    Buffer result;
-    result += ssSaveInternal(value.first);
-    result += ssSaveInternal(value.second);
-    return result;
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename T1, typename T2>
+struct SSFixedImplSize<std::pair<T1, T2>>
+{
+    static constexpr std::optional<size_t> value = ssFixedSizeSum<T1, T2>();
+};
+
+template<typename T1, typename T2>
+size_t ssSerializedSizeImpl(const std::pair<T1, T2>& value)
+{
+    const auto firstSize = ssSerializedSizeInternal(value.first); // Sequenced, see 'Internal::SegmentSizes'
+    return firstSize + ssSerializedSizeInternal(value.second);
+}
+
+template<typename T1, typename T2>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::pair<T1, T2>>)
+{
+    ssValidateInternal<T1>(bufferReader);
+    ssValidateInternal<T2>(bufferReader);
 }
 
 template<typename T1, typename T2>
@@ -154,10 +604,34 @@ void ssLoadImpl(BufferReader& bufferReader, std::pair<T1, T2>& value)
     ssLoadInternal(bufferReader, value.second);
 }
 
+template<typename Rep, typename Period>
+void ssSaveImplTo(BufferWriter& writer, const std::chrono::duration<Rep, Period>& value)
+{
+    ssSaveInternal(writer, value.count());
+}
+
 template<typename Rep, typename Period>
 Buffer ssSaveImpl(const std::chrono::duration<Rep, Period>& value)
 {
-    return ssSaveInternal(value.count());
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename Rep, typename Period>
+struct SSFixedImplSize<std::chrono::duration<Rep, Period>>
+{
+    static constexpr std::optional<size_t> value = ssFixedSizeSum<Rep>();
+};
+
+template<typename Rep, typename Period>
+size_t ssSerializedSizeImpl(const std::chrono::duration<Rep, Period>& value)
+{
+    return ssSerializedSizeInternal(value.count());
+}
+
+template<typename Rep, typename Period>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::chrono::duration<Rep, Period>>)
+{
+    ssValidateInternal<Rep>(bufferReader);
 }
 
 template<typename Rep, typename Period>
@@ -167,21 +641,75 @@ void ssLoadImpl(BufferReader& bufferReader, std::chrono::duration<Rep, Period>&
 }
 
 template<typename Clock, typename Duration>
-Buffer ssSaveImpl(const std::chrono::time_point<Clock, Duration>& value)
+void ssSaveImplTo(BufferWriter& writer, const std::chrono::time_point<Clock, Duration>& value)
 {
-    Buffer result;
-    result.write(Helpers::Timepoint_Marker_v2_Low);
-    result.write(Helpers::Timepoint_Marker_v2_High);
+    writer.write(Helpers::Timepoint_Marker_v2_Low);
+    writer.write(Helpers::Timepoint_Marker_v2_High);
 
     if constexpr (std::is_same_v<Clock, std::chrono::steady_clock>) {
         const auto diffFromNow = value - Clock::now();
         const auto systemTp = std::chrono::system_clock::now() + diffFromNow; // Possible time drift here
-        result += ssSave(systemTp.time_since_epoch(), false);
+        ssSaveTo(writer, systemTp.time_since_epoch(), false);
     } else {
-        result += ssSave(value.time_since_epoch(), false);
+        ssSaveTo(writer, value.time_since_epoch(), false);
     }
+}
 
-    return result;
+template<typename Clock, typename Duration>
+Buffer ssSaveImpl(const std::chrono::time_point<Clock, Duration>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+// Steady clock time points are stored as system clock ones, see 'ssSaveImplTo'
+template<typename Clock, typename Duration>
+using SSTimepointStoredDuration =
+    std::conditional_t<std::is_same_v<Clock, std::chrono::steady_clock>,
+                       decltype((std::chrono::system_clock::now() + (std::declval<std::chrono::time_point<Clock, Duration>>() - Clock::now())).time_since_epoch()),
+                       Duration>;
+
+template<typename Clock, typename Duration>
+struct SSFixedImplSize<std::chrono::time_point<Clock, Duration>>
+{
+    static constexpr std::optional<size_t> value =
+        ssFixedSizeSum<uint64_t, uint64_t, SSTimepointStoredDuration<Clock, Duration>>();
+};
+
+template<typename Clock, typename Duration>
+size_t ssSerializedSizeImpl(const std::chrono::time_point<Clock, Duration>& value)
+{
+    if (!Internal::isCompactFormat())
+        return *SSFixedImplSize<std::chrono::time_point<Clock, Duration>>::value;
+
+    // Varint size depends on value, mirror 'ssSaveImplTo'
+    if constexpr (std::is_same_v<Clock, std::chrono::steady_clock>) {
+        const auto systemTp = std::chrono::system_clock::now() + (value - Clock::now());
+        return sizeof(uint64_t) * 2 + ssSerializedSizeInternal(systemTp.time_since_epoch());
+    } else {
+        return sizeof(uint64_t) * 2 + ssSerializedSizeInternal(value.time_since_epoch());
+    }
+}
+
+template<typename Clock, typename Duration>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::chrono::time_point<Clock, Duration>>)
+{
+    const auto initialPos = bufferReader.position();
+
+    if (bufferReader.rest() >= sizeof(uint64_t) * 2 &&
+        bufferReader.read<uint64_t>() == Helpers::Timepoint_Marker_v2_Low &&
+        bufferReader.read<uint64_t>() == Helpers::Timepoint_Marker_v2_High) {
+        ssValidateInternal<Duration>(bufferReader);
+        return;
+    }
+
+    // Old format data
+    bufferReader.seek(initialPos);
+
+    if constexpr (std::is_same_v<Clock, std::chrono::steady_clock>) {
+        ssValidateInternal<std::chrono::steady_clock::duration>(bufferReader);
+    } else {
+        Internal::throwFormat();
+    }
 }
 
 template<typename Clock, typename Duration>
@@ -222,16 +750,41 @@ void ssLoadImpl(BufferReader& bufferReader, std::chrono::time_point<Clock, Durat
     }
 }
 
+template<typename T>
+void ssSaveImplTo(BufferWriter& writer, const std::shared_ptr<T>& value)
+{
+    writer.write(!!value);
+
+    if (!value)
+        return;
+
+    if (writer.isChained()) {
+        // Pointee is kept alive by the chain, so its large payload can be referenced
+        const std::shared_ptr<const void> owner(value);
+        Internal::SharedPayloadScope sharedScope(owner);
+        ssSaveInternal(writer, *value);
+    } else {
+        ssSaveInternal(writer, *value);
+    }
+}
+
 template<typename T>
 Buffer ssSaveImpl(const std::shared_ptr<T>& value)
 {
-    Buffer result;
-    result.write(!!value);
+    return ssSaveImplViaWriter(value);
+}
 
-    if (value)
-        result += ssSaveInternal(*value);
+template<typename T>
+size_t ssSerializedSizeImpl(const std::shared_ptr<T>& value)
+{
+    return sizeof(bool) + (value ? ssSerializedSizeInternal(*value) : 0);
+}
 
-    return result;
+template<typename T>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::shared_ptr<T>>)
+{
+    if (Internal::ssValidateFlag(bufferReader))
+        ssValidateInternal<T>(bufferReader);
 }
 
 template<typename T>
@@ -253,15 +806,31 @@ void ssLoadImpl(BufferReader& bufferReader, std::shared_ptr<T>& value)
 }
 
 template<typename T>
-Buffer ssSaveImpl(const std::unique_ptr<T>& value)
+void ssSaveImplTo(BufferWriter& writer, const std::unique_ptr<T>& value)
 {
-    Buffer result;
-    result.write(!!value);
+    writer.write(!!value);
 
     if (value)
-        result += ssSaveInternal(*value);
+        ssSaveInternal(writer, *value);
+}
 
-    return result;
+template<typename T>
+Buffer ssSaveImpl(const std::unique_ptr<T>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename T>
+size_t ssSerializedSizeImpl(const std::unique_ptr<T>& value)
+{
+    return sizeof(bool) + (value ? ssSerializedSizeInternal(*value) : 0);
+}
+
+template<typename T>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::unique_ptr<T>>)
+{
+    if (Internal::ssValidateFlag(bufferReader))
+        ssValidateInternal<T>(bufferReader);
 }
 
 template<typename T>
@@ -271,10 +840,12 @@ void ssLoadImpl(BufferReader& bufferReader, std::unique_ptr<T>& value)
     ssLoadImpl(bufferReader, hasValue);
 
     if (hasValue) {
-        if constexpr (std::is_constructible_v<T, SS_SERIALIZER_TAG>) {
-            value = std::make_unique<T>(SS_SERIALIZER_TAG{});
-        } else {
-            value = std::make_unique<T>();
+        if (!value || !Internal::isLoadingInPlace()) {
+            if constexpr (std::is_constructible_v<T, SS_SERIALIZER_TAG>) {
+                value = std::make_unique<T>(SS_SERIALIZER_TAG{});
+            } else {
+                value = std::make_unique<T>();
+            }
         }
         ssLoadInternal(bufferReader, *value);
     } else { // Just precaution
@@ -282,19 +853,43 @@ void ssLoadImpl(BufferReader& bufferReader, std::unique_ptr<T>& value)
     }
 }
 
+void ssSaveImplTo(BufferWriter& writer, const std::string& value);
 Buffer ssSaveImpl(const std::string& value);
+size_t ssSerializedSizeImpl(const std::string& value);
 void ssLoadImpl(BufferReader& bufferReader, std::string& value);
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::string>);
+
+// Same data as 'std::string'. Loaded as a view into the source memory, which must outlive it.
+void ssSaveImplTo(BufferWriter& writer, std::string_view value);
+Buffer ssSaveImpl(std::string_view value);
+size_t ssSerializedSizeImpl(std::string_view value);
+void ssLoadImpl(BufferReader& bufferReader, std::string_view& value);
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::string_view>);
+
+// Same data as 'std::string'. Loaded with the memory resource of the target string.
+void ssSaveImplTo(BufferWriter& writer, const std::pmr::string& value);
+Buffer ssSaveImpl(const std::pmr::string& value);
+size_t ssSerializedSizeImpl(const std::pmr::string& value);
+void ssLoadImpl(BufferReader& bufferReader, std::pmr::string& value);
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::pmr::string>);
 
 
 #ifdef SUITABLE_STRUCT_HAS_QT_LIBRARY
 template<typename Arg>     struct IsContainer<QVector<Arg>> : public std::true_type { };
 template<typename... Args> struct IsContainer<QList<Args...>> : public std::true_type { };
 template<>                 struct IsContainer<QStringList> : public std::true_type { };
+template<typename Arg>     struct IsContiguousContainer<QVector<Arg>> : public std::true_type { };
 
+void ssSaveImplTo(BufferWriter& writer, const QByteArray& value);
 Buffer ssSaveImpl(const QByteArray& value);
+size_t ssSerializedSizeImpl(const QByteArray& value);
 void ssLoadImpl(BufferReader& bufferReader, QByteArray& value);
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QByteArray>);
+void ssSaveImplTo(BufferWriter& writer, const QString& value);
 Buffer ssSaveImpl(const QString& value);
+size_t ssSerializedSizeImpl(const QString& value);
 void ssLoadImpl(BufferReader& bufferReader, QString& value);
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QString>);
 Buffer ssSaveImpl(const QPoint& value);
 void ssLoadImpl(BufferReader& bufferReader, QPoint& value);
 Buffer ssSaveImpl(const QPointF& value);
@@ -322,18 +917,240 @@ void ssLoadImpl(BufferReader& bufferReader, QDateTime& value);
 #endif // SUITABLE_STRUCT_HAS_QT_LIBRARY
 
 template<typename C>
-Buffer ssSaveContainerImpl (const C& value)
+constexpr bool IsContiguousOfPrimitives_v =
+    IsContiguousContainer<C>::value &&
+    (std::is_fundamental_v<typename ContainerItemType<C>::type> || std::is_enum_v<typename ContainerItemType<C>::type>);
+
+template<typename C>
+constexpr bool IsRandomAccessContainer_v =
+    std::is_base_of_v<std::random_access_iterator_tag,
+                      typename std::iterator_traits<decltype(std::begin(std::declval<const C&>()))>::iterator_category>;
+
+// Whether items of container 'C' of 'size' items are saved by chunks (see 'ssSaveItemsParallel'),
+// unless the writer is chained. Nested containers of such items are saved sequentially.
+template<typename C>
+bool ssIsParallelSave(size_t size)
 {
-    Buffer result;
+    if constexpr (IsRandomAccessContainer_v<C> && !Internal::ssIsPositionDependent<typename ContainerItemType<C>::type>()) {
+        const auto& options = Internal::currentParallelSave();
+        return options && size > std::max<size_t>(options->grain, 1);
+    } else {
+        return false;
+    }
+}
+
+// Saves items of 'value' by chunks on several threads, see 'SSParallelSave'.
+// The first chunk is written straight into 'writer', others into own buffers. Each buffer is appended
+// as soon as preceding chunks are written and released, so only chunks done out of order are kept.
+// Chunk ends are patched into the index at 'indexPos', if any (see 'ssSaveIndexedItems').
+// Returns false (nothing written) if the container should be saved sequentially.
+template<typename C>
+bool ssSaveItemsParallel(BufferWriter& writer, const C& value, size_t size, std::optional<size_t> indexPos = {})
+{
+    if constexpr (Internal::ssIsPositionDependent<typename ContainerItemType<C>::type>()) {
+        return false;
+    } else {
+        const auto& options = Internal::currentParallelSave();
+        if (!options || writer.isChained())
+            return false;
+
+        const auto grain = std::max<size_t>(options->grain, 1);
+        const auto chunksCount = (size + grain - 1) / grain;
+        if (chunksCount < 2)
+            return false;
+
+        // Compact format: segment sizes of chunks, measured by the outermost segment
+        const auto sizes = Internal::currentSegmentSizes();
+        auto chunkSizes = sizes ? sizes->takeChunks(chunksCount) : std::vector<Internal::SegmentSizes>();
+
+        const auto itemsPos = writer.position();
+        std::vector<std::optional<Buffer>> chunks(chunksCount);
+        size_t chunksWritten = 0;
+        std::mutex mutex;
+
+        auto saveChunk = [&value, grain, size](BufferWriter& chunkWriter, size_t index) {
+            const auto begin = std::begin(value) + static_cast<std::ptrdiff_t>(index * grain);
+            const auto end = begin + static_cast<std::ptrdiff_t>(std::min(grain, size - index * grain));
+
+            for (auto it = begin; it != end; ++it)
+                ssSaveInternal(chunkWriter, *it);
+        };
+
+        Internal::runTasks(options->threads, chunksCount, [&](size_t index) {
+            Internal::SegmentSizesScope sizesScope(chunkSizes.empty() ? nullptr : &chunkSizes[index]);
+            Buffer chunk;
+
+            // Nothing is appended to 'writer' until the first chunk is done
+            if (index) {
+                BufferWriter chunkWriter(chunk);
+                saveChunk(chunkWriter, index);
+            } else {
+                saveChunk(writer, index);
+            }
+
+            std::lock_guard lock(mutex);
+            chunks[index] = std::move(chunk);
+
+            for (; chunksWritten < chunksCount && chunks[chunksWritten]; chunksWritten++) {
+                writer.writeRaw(chunks[chunksWritten]->cdata(), chunks[chunksWritten]->size());
+                chunks[chunksWritten] = Buffer(); // Released, but still marks written chunk
+
+                if (indexPos)
+                    writer.patch(*indexPos + chunksWritten * sizeof(uint64_t), static_cast<uint64_t>(writer.position() - itemsPos));
+            }
+        });
+
+        return true;
+    }
+}
+
+// Format F4: writes chunk index of large containers, see 'Internal::ItemsIndex'
+template<typename C>
+void ssSaveIndexedItems(BufferWriter& writer, const C& value, size_t size)
+{
+    const auto grain = Internal::ssIndexGrain();
+
+    if (size <= grain) {
+        writer.writeVarint(0);
+    } else {
+        writer.writeVarint(grain);
+        const auto indexPos = writer.position();
+        writer.writeZeros((size + grain - 1) / grain * sizeof(uint64_t));
+        const auto itemsPos = writer.position();
+
+        if constexpr (IsRandomAccessContainer_v<C>) {
+            if (ssSaveItemsParallel(writer, value, size, indexPos))
+                return;
+        }
+
+        size_t i = 0;
+        for (const auto& x : value) {
+            ssSaveInternal(writer, x);
+
+            if (++i % grain == 0 || i == size)
+                writer.patch(indexPos + (i - 1) / grain * sizeof(uint64_t), static_cast<uint64_t>(writer.position() - itemsPos));
+        }
+
+        return;
+    }
+
+    for (const auto& x : value)
+        ssSaveInternal(writer, x);
+}
+
+template<typename C>
+void ssSaveContainerImpl (BufferWriter& writer, const C& value)
+{
+    using T = std::remove_cv_t<typename ContainerItemType<C>::type>;
+
     auto size = containerSize(value);
-    result.write(static_cast<uint64_t>(size));
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(size));
+
+    if constexpr (SSHoistFraming<T>::value) {
+        if (size)
+            ssSaveHoistedItems<T>(writer, value);
+        return;
+    }
+
+    if constexpr (IsContiguousOfPrimitives_v<C>) {
+        if (!Internal::IsVarintType_v<T> || !Internal::isCompactFormat()) {
+            // Same bytes as item-by-item writing, primitives have no framing
+            Internal::ssWriteBytesOf(writer, &value, value.data(), static_cast<size_t>(size) * sizeof(T));
+            return;
+        }
+    }
+
+    if constexpr (Internal::IsIndexedItem_v<T>) {
+        if (Internal::isIndexedFormat()) {
+            ssSaveIndexedItems(writer, value, static_cast<size_t>(size));
+            return;
+        }
+    }
+
+    if constexpr (IsRandomAccessContainer_v<C>) {
+        if (ssIsParallelSave<C>(static_cast<size_t>(size))) {
+            if (ssSaveItemsParallel(writer, value, static_cast<size_t>(size)))
+                return;
+
+            // Sequentially, as measured: chunk marks are skipped, nested containers aren't saved by chunks
+            const auto grain = std::max<size_t>(Internal::currentParallelSave()->grain, 1);
+            if (const auto sizes = Internal::currentSegmentSizes())
+                sizes->skipChunks((static_cast<size_t>(size) + grain - 1) / grain);
+
+            Internal::ParallelSaveScope parallelScope(std::nullopt);
+            for (const auto& x : value)
+                ssSaveInternal(writer, x);
+            return;
+        }
+    }
 
     for (const auto& x : value)
-        result += ssSaveInternal(x);
+        ssSaveInternal(writer, x);
+}
 
+template<typename C>
+Buffer ssSaveContainerImpl (const C& value)
+{
+    Buffer result;
+    BufferWriter writer(result);
+    ssSaveContainerImpl(writer, value);
+    return result;
+}
+
+template<typename C>
+size_t ssSerializedSizeContainerImpl (const C& value)
+{
+    using T = std::decay_t<typename ContainerItemType<C>::type>;
+    const auto count = containerSize(value);
+
+    if constexpr (SSHoistFraming<T>::value)
+        return Internal::ssLengthSize(count) + (count ? ssSerializedSizeHoistedItems<T>(value) : 0);
+
+    if constexpr (SSFixedSize<T>::value) {
+        if (!Internal::isCompactFormat())
+            return sizeof(uint64_t) + count * SSFixedSize<T>::size;
+    }
+
+    size_t result = Internal::ssLengthSize(count);
+
+    if constexpr (Internal::IsIndexedItem_v<T>) {
+        if (Internal::isIndexedFormat())
+            result += Internal::ssIndexSize(count);
+    }
+
+    if (ssIsParallelSave<C>(static_cast<size_t>(count))) {
+        // Items of chunks are saved with sizes recorded from chunk marks, see 'ssSaveItemsParallel'
+        const auto grain = std::max<size_t>(Internal::currentParallelSave()->grain, 1);
+        const auto sizes = Internal::currentSegmentSizes();
+        const auto isRecording = sizes && sizes->isRecording();
+        Internal::ParallelSaveScope parallelScope(std::nullopt);
+
+        size_t i = 0;
+        for (const auto& x : value) {
+            if (isRecording && i++ % grain == 0)
+                sizes->markChunk();
+
+            result += ssSerializedSizeInternal(x);
+        }
+
+        if (isRecording)
+            sizes->markChunk();
+
+        return result;
+    }
+
+    for (const auto& x : value)
+        result += ssSerializedSizeInternal(x);
     return result;
 }
 
+template<typename C,
+         typename std::enable_if_t<IsContainer<C>::value>* = nullptr>
+void ssSaveImplTo (BufferWriter& writer, const C& value)
+{
+    ssSaveContainerImpl(writer, value);
+}
+
 template<typename C,
          typename std::enable_if_t<IsContainer<C>::value>* = nullptr>
 Buffer ssSaveImpl (const C& value)
@@ -342,6 +1159,13 @@ Buffer ssSaveImpl (const C& value)
 }
 
 // std::array<T, N>
+template<template<typename, size_t> typename C, typename T, size_t N,
+         typename std::enable_if_t<IsContainer<C<T,N>>::value>* = nullptr>
+void ssSaveImplTo (BufferWriter& writer, const C<T,N>& value)
+{
+    ssSaveContainerImpl(writer, value);
+}
+
 template<template<typename, size_t> typename C, typename T, size_t N,
          typename std::enable_if_t<IsContainer<C<T,N>>::value>* = nullptr>
 Buffer ssSaveImpl (const C<T,N>& value)
@@ -349,19 +1173,144 @@ Buffer ssSaveImpl (const C<T,N>& value)
     return ssSaveContainerImpl(value);
 }
 
+template<typename C,
+         typename std::enable_if_t<IsContainer<C>::value>* = nullptr>
+size_t ssSerializedSizeImpl (const C& value)
+{
+    return ssSerializedSizeContainerImpl(value);
+}
+
+template<template<typename, size_t> typename C, typename T, size_t N,
+         typename std::enable_if_t<IsContainer<C<T,N>>::value>* = nullptr>
+size_t ssSerializedSizeImpl (const C<T,N>& value)
+{
+    return ssSerializedSizeContainerImpl(value);
+}
+
+template<template<typename, size_t> typename C, typename T, size_t N>
+struct SSFixedImplSize<C<T,N>, std::enable_if_t<IsContainer<C<T,N>>::value>>
+{
+    static constexpr std::optional<size_t> value =
+        ssFixedSizeInternal<T>().has_value() && !SSHoistFraming<T>::value ? std::optional<size_t>(sizeof(uint64_t) + N * *ssFixedSizeInternal<T>()) : std::nullopt;
+};
+
 template<typename C>
-void ssLoadContainerImpl (BufferReader& bufferReader, C& value)
+void ssLoadContiguousContainerImpl (BufferReader& bufferReader, C& value, uint64_t sz)
 {
     using T = typename ContainerItemType<C>::type;
 
-    uint64_t sz;
-    bufferReader.read(sz);
+    if (sz > bufferReader.rest() / sizeof(T))
+        Internal::throwOutOfRange();
+
+    if constexpr (can_resize<C, size_t>::value) {
+        if (Internal::isLoadingInPlace()) {
+            value.resize(static_cast<size_t>(sz));
+            if (sz) // data() of empty container may be nullptr
+                bufferReader.readRaw(value.data(), static_cast<size_t>(sz) * sizeof(T));
+            return;
+        }
+    }
+
+    auto result = construct<C>();
+
+    if constexpr (can_resize<C, size_t>::value) {
+        result.resize(static_cast<size_t>(sz));
+    } else if (sz > containerSize(result)) { // Fixed-size, e.g. std::array
+        Internal::throwOutOfRange();
+    }
+
+    if (sz)
+        bufferReader.readRaw(result.data(), static_cast<size_t>(sz) * sizeof(T));
 
-    C result;
+    value = std::move(result);
+}
+
+// Upper bound of items of 'C' the rest of input can hold
+template<typename C>
+size_t ssMaxItemsInRest (const BufferReader& bufferReader)
+{
+    using T = std::decay_t<typename ContainerItemType<C>::type>;
+
+    // Varints make fixed-size items shorter
+    const size_t minItemSize = Internal::isCompactFormat() ? 1 : std::max<size_t>(SSFixedSize<T>::size, 1);
+    return bufferReader.rest() / minItemSize;
+}
+
+// Reserves room for 'count' items of 'C', but not more than the rest of input can hold,
+// so a corrupted count can't trigger a huge allocation
+template<typename C>
+void ssReserveContainer (C& container, uint64_t count, const BufferReader& bufferReader)
+{
+    const auto limit = ssMaxItemsInRest<C>(bufferReader);
+    ContainerReserver<C>::reserve(container, static_cast<size_t>(std::min<uint64_t>(count, limit)));
+}
+
+// In-place mode: items are loaded over the existing ones, reusing their storage
+template<typename C>
+bool ssLoadContainerInPlace (BufferReader& bufferReader, C& value, uint64_t sz)
+{
+    using T = typename ContainerItemType<C>::type;
+
+    if constexpr (can_resize<C, size_t>::value && std::is_same_v<decltype(*std::begin(value)), T&>) {
+        // vector, deque, list...
+        if (sz > ssMaxItemsInRest<C>(bufferReader))
+            Internal::throwOutOfRange();
+
+        value.resize(static_cast<size_t>(sz));
+
+        for (auto& item : value)
+            ssLoadInternal(bufferReader, item);
+
+        return true;
+
+    } else if constexpr (can_clear<C>::value) {
+        // Node-based containers: unordered ones keep their buckets
+        value.clear();
+        ssReserveContainer(value, sz, bufferReader);
+        auto sIt = ContainerInserter<C>::get(value);
+
+        for (uint64_t i = 0; i < sz; i++) {
+            auto item = construct<T>();
+            ssLoadInternal(bufferReader, item);
+            *sIt++ = std::move(item);
+        }
+
+        return true;
+
+    } else {
+        return false;
+    }
+}
+
+// Empty container to load 'sz' items into
+template<typename C>
+C ssConstructContainer (uint64_t sz)
+{
+    auto result = construct<C>();
+
+    if constexpr (!can_resize<C, size_t>::value && IsContiguousContainer<C>::value) {
+        if (sz > containerSize(result)) // Fixed-size, e.g. std::array
+            Internal::throwOutOfRange();
+    }
+
+    return result;
+}
+
+// Loads 'sz' items one by one
+template<typename C>
+void ssLoadContainerItems (BufferReader& bufferReader, C& value, uint64_t sz)
+{
+    using T = typename ContainerItemType<C>::type;
+
+    if (Internal::isLoadingInPlace() && ssLoadContainerInPlace(bufferReader, value, sz))
+        return;
+
+    auto result = ssConstructContainer<C>(sz);
     auto sIt = ContainerInserter<C>::get(result);
+    ssReserveContainer(result, sz, bufferReader);
 
     for (uint64_t i = 0; i < sz; i++) {
-        T item;
+        auto item = construct<T>();
         ssLoadInternal(bufferReader, item);
         *sIt++ = std::move(item);
     }
@@ -369,6 +1318,114 @@ void ssLoadContainerImpl (BufferReader& bufferReader, C& value)
     value = std::move(result);
 }
 
+// Loads chunks of indexed container on several threads, see 'SSParallelLoad'.
+// Returns false (nothing loaded) if the container should be loaded sequentially.
+template<typename C>
+bool ssLoadItemsParallel (const BufferReader& items, C& value, uint64_t sz, const Internal::ItemsIndex& index)
+{
+    using T = std::remove_cv_t<typename ContainerItemType<C>::type>;
+
+    const auto& options = Internal::currentParallelLoad();
+    if (!options || index.chunksCount() < 2 || Internal::isLoadingInPlace())
+        return false;
+
+    std::vector<std::vector<T>> slices(index.chunksCount());
+    Internal::runTasks(options->threads, slices.size(), [&items, &slices, &index, sz](size_t chunk) {
+        auto reader = index.chunkData(items, chunk);
+        const auto count = index.chunkItems(chunk, sz);
+
+        if (count > ssMaxItemsInRest<C>(reader))
+            Internal::throwOutOfRange();
+
+        auto& slice = slices[chunk];
+        slice.reserve(static_cast<size_t>(count));
+
+        for (uint64_t i = 0; i < count; i++) {
+            auto item = construct<T>();
+            ssLoadInternal(reader, item);
+            slice.push_back(std::move(item));
+        }
+
+        if (reader.rest())
+            Internal::throwFormat();
+    });
+
+    // All items are loaded, so the count is real
+    auto result = ssConstructContainer<C>(sz);
+    ContainerReserver<C>::reserve(result, static_cast<size_t>(sz));
+    auto sIt = ContainerInserter<C>::get(result);
+
+    for (auto& slice : slices)
+        for (auto& item : slice)
+            *sIt++ = std::move(item);
+
+    value = std::move(result);
+    return true;
+}
+
+// Format F4, see 'Internal::ItemsIndex'
+template<typename C>
+void ssLoadIndexedContainer (BufferReader& bufferReader, C& value, uint64_t sz)
+{
+    const auto index = Internal::ssReadItemsIndex(bufferReader, sz);
+
+    if (!index.grain) {
+        ssLoadContainerItems(bufferReader, value, sz);
+        return;
+    }
+
+    auto items = bufferReader.readRaw(static_cast<size_t>(index.itemsSize()));
+
+    if (ssLoadItemsParallel(items, value, sz, index))
+        return;
+
+    ssLoadContainerItems(items, value, sz);
+
+    if (items.rest())
+        Internal::throwFormat();
+}
+
+template<typename C>
+void ssLoadContainerImpl (BufferReader& bufferReader, C& value)
+{
+    using T = typename ContainerItemType<C>::type;
+
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if constexpr (IsContiguousOfPrimitives_v<C>) {
+        if (!Internal::IsVarintType_v<T> || !Internal::isCompactFormat()) {
+            ssLoadContiguousContainerImpl(bufferReader, value, sz);
+            return;
+        }
+    }
+
+    if constexpr (SSHoistFraming<std::remove_cv_t<T>>::value) {
+        // F0 data never has hoisted framing
+        if (!isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false)) {
+            auto result = ssConstructContainer<C>(sz);
+            auto sIt = ContainerInserter<C>::get(result);
+
+            if (sz) {
+                // Item payload takes at least one byte
+                ContainerReserver<C>::reserve(result, static_cast<size_t>(std::min<uint64_t>(sz, bufferReader.rest())));
+                ssLoadHoistedItems<std::remove_cv_t<T>>(bufferReader, sz, [&sIt](auto&& item) { *sIt++ = std::move(item); });
+            }
+
+            value = std::move(result);
+            return;
+        }
+    }
+
+    if constexpr (Internal::IsIndexedItem_v<std::remove_cv_t<T>>) {
+        if (Internal::isIndexedFormat()) {
+            ssLoadIndexedContainer(bufferReader, value, sz);
+            return;
+        }
+    }
+
+    ssLoadContainerItems(bufferReader, value, sz);
+}
+
 template<typename C,
          typename std::enable_if_t<IsContainer<C>::value>* = nullptr>
 void ssLoadImpl (BufferReader& bufferReader, C& value)
@@ -384,15 +1441,162 @@ void ssLoadImpl (BufferReader& bufferReader, C<T,N>& value)
     ssLoadContainerImpl(bufferReader, value);
 }
 
+// Loads item 'index' of container data, skipping preceding items: by their size if fixed-sized
+// (uncompact formats), by chunk index in format F4 (at most 'grain - 1' items), by framing otherwise.
+// Hoisted items are stored by columns, so the whole container is loaded.
+template<typename C>
+auto ssLoadContainerItem (BufferReader& bufferReader, uint64_t index)
+{
+    using T = std::remove_cv_t<typename ContainerItemType<C>::type>;
+
+    const auto start = bufferReader.position();
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (index >= sz)
+        Internal::throwOutOfRange();
+
+    auto item = construct<T>();
+
+    if constexpr (SSHoistFraming<T>::value) {
+        if (!isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false)) {
+            bufferReader.seek(start);
+            auto container = construct<C>();
+            ssLoadContainerImpl(bufferReader, container);
+            item = std::move(*std::next(std::begin(container), static_cast<std::ptrdiff_t>(index)));
+            return item;
+        }
+    }
+
+    if constexpr (SSFixedSize<T>::value) {
+        if (!Internal::isCompactFormat()) {
+            if (SSFixedSize<T>::size && index > bufferReader.rest() / SSFixedSize<T>::size)
+                Internal::throwOutOfRange();
+
+            bufferReader.advance(static_cast<std::ptrdiff_t>(index * SSFixedSize<T>::size));
+            ssLoadInternal(bufferReader, item);
+            return item;
+        }
+    }
+
+    if constexpr (Internal::IsIndexedItem_v<T>) {
+        if (Internal::isIndexedFormat()) {
+            const auto itemsIndex = Internal::ssReadItemsIndex(bufferReader, sz);
+
+            if (itemsIndex.grain) {
+                const auto items = bufferReader.readRaw(static_cast<size_t>(itemsIndex.itemsSize()));
+                auto reader = itemsIndex.chunkData(items, static_cast<size_t>(index / itemsIndex.grain));
+
+                for (uint64_t i = 0; i < index % itemsIndex.grain; i++)
+                    ssSkipInternal<T>(reader);
+
+                ssLoadInternal(reader, item);
+                return item;
+            }
+        }
+    }
+
+    for (uint64_t i = 0; i < index; i++)
+        ssSkipInternal<T>(bufferReader);
+
+    ssLoadInternal(bufferReader, item);
+    return item;
+}
+
+// Items of generic containers, with chunk index in format F4
+template<typename T>
+void ssValidateContainerItems (BufferReader& bufferReader, uint64_t sz)
+{
+    if constexpr (Internal::IsIndexedItem_v<T>) {
+        if (Internal::isIndexedFormat()) {
+            const auto index = Internal::ssReadItemsIndex(bufferReader, sz);
+
+            if (index.grain) {
+                const auto items = bufferReader.readRaw(static_cast<size_t>(index.itemsSize()));
+
+                for (size_t chunk = 0; chunk < index.chunksCount(); chunk++) {
+                    auto reader = index.chunkData(items, chunk);
+                    Internal::ssValidateItems<T>(reader, index.chunkItems(chunk, sz));
+
+                    if (reader.rest())
+                        Internal::throwFormat();
+                }
+
+                return;
+            }
+        }
+    }
+
+    Internal::ssValidateItems<T>(bufferReader, sz);
+}
+
+template<typename C,
+         typename std::enable_if_t<IsContainer<C>::value>* = nullptr>
+void ssValidateImpl (BufferReader& bufferReader, SSTypeTag<C>)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if constexpr (SSHoistFraming<std::remove_cv_t<typename ContainerItemType<C>::type>>::value) {
+        if (sz)
+            ssValidateHoistedItems<std::remove_cv_t<typename ContainerItemType<C>::type>>(bufferReader, sz);
+        return;
+    }
+
+    ssValidateContainerItems<std::remove_cv_t<typename ContainerItemType<C>::type>>(bufferReader, sz);
+}
+
+// std::array<T, N>
+template<template<typename, size_t> typename C, typename T, size_t N,
+         typename std::enable_if_t<IsContainer<C<T,N>>::value>* = nullptr>
+void ssValidateImpl (BufferReader& bufferReader, SSTypeTag<C<T,N>>)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (sz > N)
+        Internal::throwOutOfRange();
+
+    if constexpr (SSHoistFraming<T>::value) {
+        if (sz)
+            ssValidateHoistedItems<T>(bufferReader, sz);
+        return;
+    }
+
+    ssValidateContainerItems<T>(bufferReader, sz);
+}
+
 template<typename... Args>
-Buffer ssSaveImpl (const std::tuple<Args...>& value)
+void ssSaveImplTo (BufferWriter& writer, const std::tuple<Args...>& value)
 {
-    Buffer result;
-    auto saver = [&result](const auto& x){ result += ssSaveInternal(x); };
+    auto saver = [&writer](const auto& x){ ssSaveInternal(writer, x); };
     std::apply([&saver](const auto&... xs){ (saver(xs), ...); }, value);
+}
+
+template<typename... Args>
+Buffer ssSaveImpl (const std::tuple<Args...>& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+// Also matches tuples of references returned by 'ssTuple'
+template<typename... Args>
+struct SSFixedImplSize<std::tuple<Args...>>
+{
+    static constexpr std::optional<size_t> value = ssFixedSizeSum<Args...>();
+};
+
+template<typename... Args>
+size_t ssSerializedSizeImpl (const std::tuple<Args...>& value)
+{
+    size_t result {}; // Sequenced, see 'Internal::SegmentSizes'
+    std::apply([&result](const auto&... xs){ ((result += ssSerializedSizeInternal(xs)), ...); }, value);
     return result;
 }
 
+template<typename... Args>
+void ssValidateImpl (BufferReader& bufferReader, SSTypeTag<std::tuple<Args...>>)
+{
+    (ssValidateInternal<Args>(bufferReader), ...);
+}
+
 template<typename... Args>
 void ssLoadImpl (BufferReader& bufferReader, std::tuple<Args...>& value)
 {
@@ -401,22 +1605,52 @@ void ssLoadImpl (BufferReader& bufferReader, std::tuple<Args...>& value)
 }
 
 #ifdef SUITABLE_STRUCT_HAS_QT_LIBRARY
+template<typename Key, typename Value> struct SSNestedTypes<QMap<Key, Value>> { using type = std::tuple<Key, Value>; };
+template<typename Key, typename Value> struct SSNestedTypes<QHash<Key, Value>> { using type = std::tuple<Key, Value>; };
+
 // QMap binary
+template<typename Key, typename Value>
+void ssSaveImplTo(BufferWriter& writer, const QMap<Key, Value>& value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+    for (auto it = value.keyValueBegin(); it != value.keyValueEnd(); ++it)
+        ssSaveInternal(writer, std::pair<Key, Value>(it->first, it->second));
+}
+
 template<typename Key, typename Value>
 Buffer ssSaveImpl(const QMap<Key, Value>& value)
 {
-    Buffer result;
-    result.write(static_cast<uint64_t>(value.size()));
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename Key, typename Value>
+size_t ssSerializedSizeImpl(const QMap<Key, Value>& value)
+{
+    using Item = std::pair<Key, Value>;
+
+    if constexpr (SSFixedSize<Item>::value) {
+        if (!Internal::isCompactFormat())
+            return sizeof(uint64_t) + static_cast<size_t>(value.size()) * SSFixedSize<Item>::size;
+    }
+
+    // Mirrors the save, so sizes of nested segments are recorded in order (see 'Internal::SegmentSizes')
+    size_t result = Internal::ssLengthSize(static_cast<uint64_t>(value.size()));
     for (auto it = value.keyValueBegin(); it != value.keyValueEnd(); ++it)
-        result += ssSaveInternal(std::pair<Key, Value>(it->first, it->second));
+        result += ssSerializedSizeInternal(Item(it->first, it->second));
     return result;
 }
 
+template<typename Key, typename Value>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QMap<Key, Value>>)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+    Internal::ssValidateItems<std::pair<Key, Value>>(bufferReader, sz);
+}
+
 template<typename Key, typename Value>
 void ssLoadImpl(BufferReader& bufferReader, QMap<Key, Value>& value)
 {
-    uint64_t sz;
-    bufferReader.read(sz);
+    const auto sz = Internal::ssReadLength(bufferReader);
     QMap<Key, Value> result;
     for (uint64_t i = 0; i < sz; i++) {
         std::pair<Key, Value> item;
@@ -427,22 +1661,50 @@ void ssLoadImpl(BufferReader& bufferReader, QMap<Key, Value>& value)
 }
 
 // QHash binary
+template<typename Key, typename Value>
+void ssSaveImplTo(BufferWriter& writer, const QHash<Key, Value>& value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+    for (auto it = value.keyValueBegin(); it != value.keyValueEnd(); ++it)
+        ssSaveInternal(writer, std::pair<Key, Value>(it->first, it->second));
+}
+
 template<typename Key, typename Value>
 Buffer ssSaveImpl(const QHash<Key, Value>& value)
 {
-    Buffer result;
-    result.write(static_cast<uint64_t>(value.size()));
+    return ssSaveImplViaWriter(value);
+}
+
+template<typename Key, typename Value>
+size_t ssSerializedSizeImpl(const QHash<Key, Value>& value)
+{
+    using Item = std::pair<Key, Value>;
+
+    if constexpr (SSFixedSize<Item>::value) {
+        if (!Internal::isCompactFormat())
+            return sizeof(uint64_t) + static_cast<size_t>(value.size()) * SSFixedSize<Item>::size;
+    }
+
+    // Mirrors the save, so sizes of nested segments are recorded in order (see 'Internal::SegmentSizes')
+    size_t result = Internal::ssLengthSize(static_cast<uint64_t>(value.size()));
     for (auto it = value.keyValueBegin(); it != value.keyValueEnd(); ++it)
-        result += ssSaveInternal(std::pair<Key, Value>(it->first, it->second));
+        result += ssSerializedSizeInternal(Item(it->first, it->second));
     return result;
 }
 
+template<typename Key, typename Value>
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QHash<Key, Value>>)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+    Internal::ssValidateItems<std::pair<Key, Value>>(bufferReader, sz);
+}
+
 template<typename Key, typename Value>
 void ssLoadImpl(BufferReader& bufferReader, QHash<Key, Value>& value)
 {
-    uint64_t sz;
-    bufferReader.read(sz);
+    const auto sz = Internal::ssReadLength(bufferReader);
     QHash<Key, Value> result;
+    ssReserveContainer(result, sz, bufferReader);
     for (uint64_t i = 0; i < sz; i++) {
         std::pair<Key, Value> item;
         ssLoadInternal(bufferReader, item);
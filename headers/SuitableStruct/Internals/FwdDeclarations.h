@@ -3,6 +3,7 @@
  * Contact:  ihor-drachuk-libs@pm.me  */
 
 #pragma once
+#include <optional>
 #include <SuitableStruct/Buffer.h>
 #include <SuitableStruct/Internals/Common.h>
 
@@ -11,15 +12,31 @@ class QJsonValue;
 namespace SuitableStruct {
 
 class BufferReader;
+class BufferWriter;
 
 template<typename T> Buffer ssSave(const T& obj, bool protectedMode = true);
+template<typename T> void ssSaveTo(BufferWriter& writer, const T& obj, bool protectedMode = true);
 template<typename T, typename> Buffer ssSaveImpl(const T& obj);
 template<typename T> Buffer ssSaveInternal(const T& obj);
+template<typename T> void ssSaveInternal(BufferWriter& writer, const T& obj);
+
+template<typename T> struct SSFixedSize;
+template<typename T> constexpr std::optional<size_t> ssFixedSizeInternal();
+template<typename T> size_t ssSerializedSize(const T& obj, bool protectedMode = true);
+template<typename T> size_t ssSerializedSizeInternal(const T& obj);
 
 template<typename T> void ssLoad(BufferReader& bufferReader, T& obj, SSLoadMode loadMode = SSLoadMode::Protected);
+template<typename T> void ssLoadInPlace(BufferReader& bufferReader, T& obj, SSLoadMode loadMode = SSLoadMode::Protected);
 template<typename T> [[nodiscard]] T ssLoadRet(BufferReader& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected);
 template<typename T> [[nodiscard]] T ssLoadInternalRet(BufferReader& bufferReader);
 template<typename T> void ssLoadInternal(BufferReader& bufferReader, T& obj);
+template<typename T> void ssValidateInternal(BufferReader& bufferReader);
+template<typename T> void ssSkipInternal(BufferReader& bufferReader);
+
+template<typename T, typename C> void ssSaveHoistedItems(BufferWriter& writer, const C& items);
+template<typename T, typename C> size_t ssSerializedSizeHoistedItems(const C& items);
+template<typename T, typename Emit> void ssLoadHoistedItems(BufferReader& bufferReader, uint64_t count, Emit&& emit);
+template<typename T> void ssValidateHoistedItems(BufferReader& bufferReader, uint64_t count);
 
 
 template<typename T> QJsonValue ssJsonSave(const T& obj, bool protectedMode = true);
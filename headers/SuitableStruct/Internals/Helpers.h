@@ -3,10 +3,12 @@
  * Contact:  ihor-drachuk-libs@pm.me  */
 
 #pragma once
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <SuitableStruct/Handlers.h>
 
@@ -15,6 +17,48 @@ namespace SuitableStruct {
 // Tag type for serializer-specific constructors
 struct SS_SERIALIZER_TAG { };
 
+// Segments written on save of versioned types. The newest segment is always written,
+// older ones while both limits allow. Loading isn't affected.
+struct SSSegmentPolicy
+{
+    uint8_t maxSegments {255}; // Amount of newest segments
+    uint8_t minVersion {0};    // Oldest wire version (see 'ssVersionOffset')
+
+    static constexpr SSSegmentPolicy all() { return {}; }
+    static constexpr SSSegmentPolicy latest(uint8_t count = 1) { return {count, 0}; }
+    static constexpr SSSegmentPolicy fromVersion(uint8_t version) { return {255, version}; }
+
+    // Both policies' limits
+    constexpr SSSegmentPolicy operator&(const SSSegmentPolicy& rhs) const {
+        return {maxSegments < rhs.maxSegments ? maxSegments : rhs.maxSegments,
+                minVersion > rhs.minVersion ? minVersion : rhs.minVersion};
+    }
+
+    // Whether segment of 'version' is written after 'segmentsWritten' newer ones
+    constexpr bool allows(size_t segmentsWritten, size_t version) const {
+        return segmentsWritten < maxSegments && version >= minVersion;
+    }
+
+    constexpr bool operator==(const SSSegmentPolicy& rhs) const { return maxSegments == rhs.maxSegments && minVersion == rhs.minVersion; }
+    constexpr bool operator!=(const SSSegmentPolicy& rhs) const { return !(*this == rhs); }
+};
+
+// Parallel save of large random access containers (e.g. 'std::vector') of non-primitive items:
+// items are split into chunks of 'grain', saved into separate buffers by up to 'threads' threads
+// and joined. Result is the same data as sequential save.
+struct SSParallelSave
+{
+    size_t threads {0};  // 0: std::thread::hardware_concurrency()
+    size_t grain {4096}; // Items per chunk. Containers of up to 'grain' items are saved sequentially
+};
+
+// Parallel load of containers indexed by format F4: chunks of items are loaded into separate slices
+// by up to 'threads' threads and moved into the container in order. Other data is loaded sequentially.
+struct SSParallelLoad
+{
+    size_t threads {0};  // 0: std::thread::hardware_concurrency()
+};
+
 namespace Internal {
 
 enum class FormatType {
@@ -39,6 +83,163 @@ private:
     std::optional<bool> m_previousJsonState;
 };
 
+// Load into existing objects reusing their storage, see 'ssLoadInPlace'
+bool isLoadingInPlace();
+
+class InPlaceLoadScope {
+public:
+    explicit InPlaceLoadScope(bool inPlace);
+    ~InPlaceLoadScope();
+
+    InPlaceLoadScope(const InPlaceLoadScope&) = delete;
+    InPlaceLoadScope& operator=(const InPlaceLoadScope&) = delete;
+
+private:
+    bool m_previousState;
+};
+
+// Compact format F3 is being saved or loaded: varint lengths, segment sizes & integers
+bool isCompactFormat();
+
+class CompactFormatScope {
+public:
+    explicit CompactFormatScope(bool isCompact);
+    ~CompactFormatScope();
+
+    CompactFormatScope(const CompactFormatScope&) = delete;
+    CompactFormatScope& operator=(const CompactFormatScope&) = delete;
+
+private:
+    bool m_previousState;
+};
+
+// Format F4 is being saved or loaded: large containers of variable-sized items are chunk-indexed
+bool isIndexedFormat();
+
+class IndexedFormatScope {
+public:
+    explicit IndexedFormatScope(bool isIndexed);
+    ~IndexedFormatScope();
+
+    IndexedFormatScope(const IndexedFormatScope&) = delete;
+    IndexedFormatScope& operator=(const IndexedFormatScope&) = delete;
+
+private:
+    bool m_previousState;
+};
+
+// Segment policy of current 'ssSave' call, see 'SSSegmentPolicy'
+const SSSegmentPolicy& currentSegmentPolicy();
+
+class SegmentPolicyScope {
+public:
+    explicit SegmentPolicyScope(const SSSegmentPolicy& policy);
+    ~SegmentPolicyScope();
+
+    SegmentPolicyScope(const SegmentPolicyScope&) = delete;
+    SegmentPolicyScope& operator=(const SegmentPolicyScope&) = delete;
+
+private:
+    SSSegmentPolicy m_previousPolicy;
+};
+
+// Parallel save options of current 'ssSave' call, see 'SSParallelSave'. Nullopt for sequential save.
+const std::optional<SSParallelSave>& currentParallelSave();
+
+class ParallelSaveScope {
+public:
+    explicit ParallelSaveScope(const std::optional<SSParallelSave>& options);
+    ~ParallelSaveScope();
+
+    ParallelSaveScope(const ParallelSaveScope&) = delete;
+    ParallelSaveScope& operator=(const ParallelSaveScope&) = delete;
+
+private:
+    std::optional<SSParallelSave> m_previousOptions;
+};
+
+// Parallel load options of current 'ssLoad' call, see 'SSParallelLoad'. Nullopt for sequential load.
+const std::optional<SSParallelLoad>& currentParallelLoad();
+
+class ParallelLoadScope {
+public:
+    explicit ParallelLoadScope(const std::optional<SSParallelLoad>& options);
+    ~ParallelLoadScope();
+
+    ParallelLoadScope(const ParallelLoadScope&) = delete;
+    ParallelLoadScope& operator=(const ParallelLoadScope&) = delete;
+
+private:
+    std::optional<SSParallelLoad> m_previousOptions;
+};
+
+// Runs 'task' for [0, count) on up to 'threads' threads (0: hardware concurrency), current one included.
+// Other threads are taken from a pool, kept between calls. Tasks get the context of the caller
+// (format, segment policy, memory resource); parallel saves & loads nested in them are sequential.
+// If the memory resource isn't thread-safe (see 'isThreadSafeResource'), all tasks are run by
+// the current thread. Rethrows the first exception of tasks.
+void runTasks(size_t threads, size_t count, const std::function<void(size_t)>& task);
+
+// Owner of the innermost 'std::shared_ptr' being saved, if 'object' is its pointee. Otherwise nullptr.
+// Lets chained 'BufferWriter' reference bytes of 'object' instead of copying them.
+const std::shared_ptr<const void>* sharedPayloadOwner(const void* object);
+
+class SharedPayloadScope {
+public:
+    explicit SharedPayloadScope(const std::shared_ptr<const void>& owner);
+    ~SharedPayloadScope();
+
+    SharedPayloadScope(const SharedPayloadScope&) = delete;
+    SharedPayloadScope& operator=(const SharedPayloadScope&) = delete;
+
+private:
+    const std::shared_ptr<const void>* m_previousOwner;
+};
+
+class SegmentSizes;
+
+// Segment sizes measured for current compact save, see 'SegmentSizes'. Nullptr if not set.
+SegmentSizes* currentSegmentSizes();
+
+class SegmentSizesScope {
+public:
+    explicit SegmentSizesScope(SegmentSizes* sizes);
+    ~SegmentSizesScope();
+
+    SegmentSizesScope(const SegmentSizesScope&) = delete;
+    SegmentSizesScope& operator=(const SegmentSizesScope&) = delete;
+
+private:
+    SegmentSizes* m_previousSizes;
+};
+
+// Memory resource for pmr objects created while loading, see 'construct'. Nullptr if not set.
+std::pmr::memory_resource* currentMemoryResource();
+
+// Resources which can be used by several threads at once: 'std::pmr::synchronized_pool_resource',
+// 'std::pmr::new_delete_resource()' and nullptr (default resource of pmr objects)
+bool isThreadSafeResource(std::pmr::memory_resource* resource);
+
+class MemoryResourceScope {
+public:
+    explicit MemoryResourceScope(std::pmr::memory_resource* resource);
+    ~MemoryResourceScope();
+
+    MemoryResourceScope(const MemoryResourceScope&) = delete;
+    MemoryResourceScope& operator=(const MemoryResourceScope&) = delete;
+
+private:
+    std::pmr::memory_resource* m_previousResource;
+};
+
+// Types constructible with 'std::pmr::polymorphic_allocator' (pmr strings & containers,
+// structs following the uses-allocator convention)
+template<typename T>
+constexpr bool UsesMemoryResource_v =
+    std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>> &&
+    (std::is_constructible_v<T, std::allocator_arg_t, const std::pmr::polymorphic_allocator<std::byte>&> ||
+     std::is_constructible_v<T, const std::pmr::polymorphic_allocator<std::byte>&>);
+
 } // namespace Internal
 
 template<typename T1, typename T2>
@@ -145,6 +346,9 @@ DECLARE_MEMBER_FUNCTION_TESTER(ssSaveImpl)
 DECLARE_MEMBER_FUNCTION_TESTER(ssHashImpl)
 DECLARE_MEMBER_FUNCTION_TESTER(ssTuple)
 DECLARE_MEMBER_FUNCTION_TESTER(size)
+DECLARE_MEMBER_FUNCTION_TESTER(resize)
+DECLARE_MEMBER_FUNCTION_TESTER(reserve)
+DECLARE_MEMBER_FUNCTION_TESTER(clear)
 
 DECLARE_MEMBER_FUNCTION_TESTER(ssNamesTuple)
 DECLARE_MEMBER_FUNCTION_TESTER(ssJsonLoadImpl)
@@ -208,12 +412,24 @@ void ssAfterLoadImpl(T&)
 {
 }
 
-// Helper function for constructing objects with serializer tag if available
+// Helper function for constructing objects with serializer tag if available.
+// Allocator-aware types get the memory resource of current load, if any.
 template<typename T>
 [[nodiscard]] T construct()
 {
     if constexpr (std::is_constructible_v<T, SS_SERIALIZER_TAG>) {
         return T(SS_SERIALIZER_TAG{});
+    } else if constexpr (Internal::UsesMemoryResource_v<T>) {
+        if (const auto resource = Internal::currentMemoryResource()) {
+            const std::pmr::polymorphic_allocator<std::byte> allocator(resource);
+            if constexpr (std::is_constructible_v<T, std::allocator_arg_t, const std::pmr::polymorphic_allocator<std::byte>&>) {
+                return T(std::allocator_arg, allocator);
+            } else {
+                return T(allocator);
+            }
+        }
+
+        return T{};
     } else {
         return T{};
     }
@@ -224,6 +440,8 @@ template<typename T>
 {
     if constexpr (std::is_constructible_v<T, SS_SERIALIZER_TAG>) {
         return std::make_unique<T>(SS_SERIALIZER_TAG{});
+    } else if constexpr (Internal::UsesMemoryResource_v<T>) {
+        return std::make_unique<T>(construct<T>());
     } else {
         return std::make_unique<T>();
     }
@@ -243,6 +461,27 @@ struct HasSSUpgradeFromInHandlers : std::false_type {};
 template<typename T, typename T2>
 struct HasSSUpgradeFromInHandlers<T, T2, std::void_t<decltype(Handlers<T>::ssUpgradeFrom(std::declval<T2>(), std::declval<T&>()))>> : std::true_type {};
 
+// Single up-conversion step. Rvalue sources are passed on as rvalues,
+// so ssUpgradeFrom(Prev&&) is picked over ssUpgradeFrom(const Prev&) when both exist.
+template<typename Target, typename Src>
+void ssUpgradeStep(Target& target, Src&& src)
+{
+    using SrcType = std::decay_t<Src>;
+
+    if constexpr (std::is_same_v<SrcType, Target>) {
+        target = std::forward<Src>(src);
+    } else if constexpr (HasSSUpgradeFromInType<Target, Src&&>::value) {
+        target.ssUpgradeFrom(std::forward<Src>(src));
+    } else if constexpr (HasSSUpgradeFromInHandlers<Target, Src&&>::value) {
+        Handlers<Target>::ssUpgradeFrom(std::forward<Src>(src), target);
+    } else if constexpr (std::is_convertible_v<Src&&, Target>) {
+        target = static_cast<Target>(std::forward<Src>(src));
+    } else {
+        static_assert(HasSSUpgradeFromInType<Target, Src&&>::value || HasSSUpgradeFromInHandlers<Target, Src&&>::value,
+                      "ssUpgradeFrom() missing for up-conversion between versions");
+    }
+}
+
 // Check if type has ssDowngradeTo in itself
 template<typename T, typename T2, typename = void>
 struct HasSSDowngradeToInType : std::false_type {};
@@ -4,21 +4,90 @@
 
 #pragma once
 #include <vector>
+#include <memory_resource>
+#include <new>
 #include <cstdint>
 #include <cstring>
 #include <cassert>
 #include <utility>
+#include <type_traits>
+#include <algorithm>
 
 namespace SuitableStruct {
 
-using ExternalSSOBuffer = std::vector<uint8_t>;
+namespace Internal {
 
+// Polymorphic allocator which default-initializes instead of value-initializing,
+// so growing a byte vector doesn't zero memory which is overwritten right away.
+template<typename T>
+class DefaultInitAllocator : public std::pmr::polymorphic_allocator<T>
+{
+public:
+    using Base = std::pmr::polymorphic_allocator<T>;
+    using Base::Base;
+
+    template<typename U>
+    struct rebind { using other = DefaultInitAllocator<U>; };
+
+    DefaultInitAllocator() = default;
+    DefaultInitAllocator(const Base& rhs) noexcept: Base(rhs) {}
+
+    template<typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U>& rhs) noexcept: Base(rhs.resource()) {}
+
+    template<typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        Base::construct(ptr, std::forward<Args>(args)...);
+    }
+
+    DefaultInitAllocator select_on_container_copy_construction() const { return {}; }
+};
+
+} // namespace Internal
+
+// Bytes appended by 'resize' are left uninitialized
+using ExternalSSOBuffer = std::vector<uint8_t, Internal::DefaultInitAllocator<uint8_t>>;
+
+// Per-thread pool of long buffers. LongSSO using 'std::pmr::new_delete_resource' (the default one)
+// takes its long buffer from the pool of current thread and gives it back on destruction,
+// as long as the capacity retained by the pool stays within the limit.
+struct SSBufferPoolStats
+{
+    size_t hits {};             // Long buffers taken from the pool
+    size_t misses {};           // Long buffers allocated because the pool was empty
+    size_t buffersRetained {};
+    size_t bytesRetained {};    // Capacity of retained buffers
+};
+
+constexpr size_t SSDefaultBufferPoolLimit = 1024 * 1024;
+
+void ssSetBufferPoolLimit(size_t bytes); // For all threads. 0 disables pooling
+size_t ssBufferPoolLimit();
+SSBufferPoolStats ssBufferPoolStats();   // Of current thread
+void ssClearBufferPool();                // Frees buffers retained by current thread
+
+namespace Internal {
+ExternalSSOBuffer* takePooledBuffer();             // nullptr if the pool is empty
+bool returnPooledBuffer(ExternalSSOBuffer* buffer); // false if the buffer isn't retained
+} // namespace Internal
+
+// Long buffer is allocated from 'memory_resource' (default one if not set), or taken from the buffer pool.
+// Like std::pmr containers, copies use the default resource and moves take the source's one.
 template<size_t sso_limit = 80>
 class LongSSO {
 public:
     LongSSO() {
     }
 
+    explicit LongSSO(std::pmr::memory_resource* resource)
+        : m_resource(resource) {
+    }
+
     LongSSO(ExternalSSOBuffer& cache) {
         m_longBuf = &cache;
     }
@@ -33,13 +102,15 @@ public:
 
     ~LongSSO() {
         if (m_deleteLongBuf)
-            delete m_longBuf;
+            deleteLongBuf(m_longBuf);
     }
 
     LongSSO& operator=(const LongSSO& rhs) { // NOLINT(bugprone-unhandled-self-assignment)
         if (this == &rhs) return *this;
 
-        *this = std::move(LongSSO(rhs));
+        LongSSO copy(m_resource);
+        copy.allocate_copy(rhs.size(), rhs.cdata());
+        *this = std::move(copy);
 
         return *this;
     }
@@ -48,17 +119,22 @@ public:
         if (this == &rhs) return *this;
 
         if (m_deleteLongBuf)
-            delete m_longBuf;
+            deleteLongBuf(m_longBuf);
 
         m_isShortBuf = rhs.m_isShortBuf;
         m_deleteLongBuf = rhs.m_deleteLongBuf;
         m_longBuf = rhs.m_longBuf;
+        m_resource = rhs.m_resource;
 
         if (m_isShortBuf) {
             m_sz = rhs.m_sz;
             memcpy(m_buf, rhs.m_buf, m_sz);
         }
 
+        // Moved-from object is empty and doesn't refer to the long buffer anymore
+        rhs.m_sz = 0;
+        rhs.m_isShortBuf = true;
+        rhs.m_longBuf = nullptr;
         rhs.m_deleteLongBuf = false;
         return *this;
     }
@@ -89,8 +165,10 @@ public:
 
             if (limitDelta >= 0) {
                 uint8_t* target = m_buf + m_sz;
-                if (buffer) memcpy(target, buffer, sz); // It's 20x faster, than doing memcpy in `appendData`
-                m_sz += sz;
+                if constexpr (sso_limit > 0) { // Otherwise nothing to copy
+                    if (buffer) memcpy(target, buffer, sz); // It's 20x faster, than doing memcpy in `appendData`
+                    m_sz = static_cast<ShortSize>(newSz);
+                }
                 return target;
             } else {
                 assert(sz > 0);
@@ -117,7 +195,7 @@ public:
     void reduceSize(size_t amount) {
         if (m_isShortBuf) {
             assert(m_sz >= amount || !"Not enough data!");
-            m_sz -= amount;
+            m_sz = static_cast<ShortSize>(m_sz - amount);
         } else {
             const auto sz = m_longBuf->size();
             assert(sz >= amount || !"Not enough data!");
@@ -125,6 +203,62 @@ public:
         }
     }
 
+    // Returns memory of unused capacity. Back to the inline buffer, if data fits it.
+    void shrink_to_fit() {
+        if (m_isShortBuf) {
+            if (m_longBuf && m_deleteLongBuf) {
+                deleteLongBuf(m_longBuf);
+                m_longBuf = nullptr;
+                m_deleteLongBuf = false;
+            }
+            return;
+        }
+
+        const auto sz = m_longBuf->size();
+
+        if (sz <= sso_limit) {
+            memcpy(m_buf, m_longBuf->data(), sz);
+            m_sz = static_cast<ShortSize>(sz);
+            m_isShortBuf = true;
+
+            if (m_deleteLongBuf) {
+                deleteLongBuf(m_longBuf);
+                m_longBuf = nullptr;
+                m_deleteLongBuf = false;
+            } else {
+                m_longBuf->clear();
+                m_longBuf->shrink_to_fit();
+            }
+        } else {
+            m_longBuf->shrink_to_fit();
+        }
+    }
+
+    size_t capacity() const {
+        if (m_isShortBuf)
+            return m_longBuf ? std::max(sso_limit, m_longBuf->capacity()) : sso_limit; // Long buffer is kept by 'clear'
+
+        return m_longBuf->capacity();
+    }
+
+    void reserve(size_t capacity) {
+        if (m_isShortBuf) {
+            if (capacity <= sso_limit)
+                return;
+
+            if (!m_longBuf) {
+                m_longBuf = newLongBuf();
+                m_deleteLongBuf = true;
+            }
+
+            m_longBuf->reserve(capacity);
+            m_longBuf->assign(m_buf, m_buf + m_sz);
+            m_isShortBuf = false;
+        } else {
+            m_longBuf->reserve(capacity);
+        }
+    }
+
     uint8_t* data() { return m_isShortBuf ? m_buf : m_longBuf->data(); }
     const uint8_t* data() const { return m_isShortBuf ? m_buf : m_longBuf->data(); }
     const uint8_t* cdata() const { return data(); }
@@ -132,6 +266,7 @@ public:
 
     static constexpr size_t getSsoLimit() { return sso_limit; }
     bool isShortBuf() const { return m_isShortBuf; }
+    std::pmr::memory_resource* memoryResource() const { return m_resource ? m_resource : std::pmr::get_default_resource(); }
 
     void clear() {
         m_sz = 0;
@@ -145,13 +280,13 @@ private:
 
         size_t newSz = m_sz + addSz;
 
-        if (m_longBuf) {
-            m_longBuf->resize(newSz);
-        } else {
-            m_longBuf = new ExternalSSOBuffer(newSz);
+        if (!m_longBuf) {
+            m_longBuf = newLongBuf();
             m_deleteLongBuf = true;
         }
 
+        m_longBuf->resize(newSz);
+
         memcpy(m_longBuf->data(), m_buf, m_sz);
 
         m_isShortBuf = false;
@@ -159,22 +294,52 @@ private:
         return m_longBuf->data() + m_sz;
     }
 
+    ExternalSSOBuffer* newLongBuf() const {
+        const auto resource = memoryResource();
+
+        if (resource == std::pmr::new_delete_resource())
+            if (const auto pooled = Internal::takePooledBuffer())
+                return pooled;
+
+        void* ptr = resource->allocate(sizeof(ExternalSSOBuffer), alignof(ExternalSSOBuffer));
+        return new (ptr) ExternalSSOBuffer(resource);
+    }
+
+    static void deleteLongBuf(ExternalSSOBuffer* buffer) {
+        const auto resource = buffer->get_allocator().resource();
+
+        if (resource == std::pmr::new_delete_resource() && Internal::returnPooledBuffer(buffer))
+            return;
+
+        buffer->~ExternalSSOBuffer();
+        resource->deallocate(buffer, sizeof(ExternalSSOBuffer), alignof(ExternalSSOBuffer));
+    }
+
     void swap(LongSSO& rhs) noexcept {
         std::swap(m_buf, rhs.m_buf);
         std::swap(m_sz, rhs.m_sz);
         std::swap(m_longBuf, rhs.m_longBuf);
         std::swap(m_isShortBuf, rhs.m_isShortBuf);
         std::swap(m_deleteLongBuf, rhs.m_deleteLongBuf);
+        std::swap(m_resource, rhs.m_resource);
     }
 
 private:
-    uint8_t m_buf[sso_limit];
-    size_t m_sz { 0 };
+    // Short size only needs to hold 'sso_limit'
+    using ShortSize = std::conditional_t<sso_limit <= UINT8_MAX, uint8_t,
+                      std::conditional_t<sso_limit <= UINT16_MAX, uint16_t, size_t>>;
 
+    // Pointers first, then small fields and the inline bytes without padding in between:
+    // 24 bytes for 'LongSSO<0>', 104 for 'LongSSO<80>' on 64-bit platforms.
+    // Long buffer pointer is kept in short mode too (external cache, capacity kept by 'clear').
     ExternalSSOBuffer* m_longBuf { nullptr };
+    std::pmr::memory_resource* m_resource { nullptr }; // nullptr: default resource
 
+    ShortSize m_sz { 0 };
     bool m_isShortBuf { true };
     bool m_deleteLongBuf { false };
+
+    uint8_t m_buf[sso_limit ? sso_limit : 1];
 };
 
 } // namespace SuitableStruct
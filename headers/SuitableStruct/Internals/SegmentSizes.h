@@ -0,0 +1,103 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <SuitableStruct/Buffer.h>
+
+namespace SuitableStruct {
+namespace Internal {
+
+// Compact format: sizes of segments of the outermost one being saved, in the order they're written.
+// Measured by one size walk when the outermost segment begins, then taken by the nested segments,
+// so each payload is measured once instead of once per enclosing segment.
+// Payloads made to measure custom savers (see 'ssSavesViaBuffer') are kept and written by the save.
+// Custom savers measure & save own segments. Items saved by chunks on other threads get slices of sizes.
+class SegmentSizes
+{
+public:
+    bool isRecording() const { return m_recording; }
+
+    // Size walk: room for the size of a segment, before measuring nested ones
+    size_t reserve() {
+        m_sizes.push_back(0);
+        return m_sizes.size() - 1;
+    }
+
+    void set(size_t slot, uint64_t size) { m_sizes[slot] = size; }
+    void keepPayload(Buffer&& payload) { m_payloads.push_back(std::move(payload)); }
+
+    // Size walk: start of a chunk of items saved on another thread, and the end of the last one
+    void markChunk() { m_chunkMarks.push_back({m_sizes.size(), m_payloads.size()}); }
+
+    // Sizes & payloads of 'count' marked chunks, for threads saving them (see 'ssSaveItemsParallel')
+    std::vector<SegmentSizes> takeChunks(size_t count) {
+        std::vector<SegmentSizes> result(count);
+
+        for (size_t i = 0; i < count; i++) {
+            const auto& begin = m_chunkMarks[m_nextChunkMark + i];
+            const auto& end = m_chunkMarks[m_nextChunkMark + i + 1];
+
+            result[i].m_sizes.assign(m_sizes.begin() + static_cast<std::ptrdiff_t>(begin.sizes),
+                                     m_sizes.begin() + static_cast<std::ptrdiff_t>(end.sizes));
+            std::move(m_payloads.begin() + static_cast<std::ptrdiff_t>(begin.payloads),
+                      m_payloads.begin() + static_cast<std::ptrdiff_t>(end.payloads),
+                      std::back_inserter(result[i].m_payloads));
+        }
+
+        skipChunks(count);
+        const auto& last = m_chunkMarks[m_nextChunkMark - 1];
+        m_next = last.sizes;
+        m_nextPayload = last.payloads;
+        return result;
+    }
+
+    // Marked chunks are saved sequentially
+    void skipChunks(size_t count) { m_nextChunkMark += count + 1; }
+
+    // Size of the next segment. Measures its subtree with 'payloadSize' if all known sizes are taken.
+    template<typename SizeFunc>
+    uint64_t take(const SizeFunc& payloadSize) {
+        if (m_next == m_sizes.size()) {
+            m_sizes.clear();
+            m_payloads.clear();
+            m_chunkMarks.clear();
+            m_next = 0;
+            m_nextPayload = 0;
+            m_nextChunkMark = 0;
+
+            m_recording = true;
+            const auto slot = reserve();
+            set(slot, static_cast<uint64_t>(payloadSize()));
+            m_recording = false;
+        }
+
+        return m_sizes[m_next++];
+    }
+
+    bool hasPayload() const { return m_next < m_sizes.size() && m_nextPayload < m_payloads.size(); }
+    Buffer takePayload() { return std::move(m_payloads[m_nextPayload++]); }
+
+private:
+    struct ChunkMark
+    {
+        size_t sizes {};
+        size_t payloads {};
+    };
+
+    std::vector<uint64_t> m_sizes;
+    std::vector<Buffer> m_payloads;
+    std::vector<ChunkMark> m_chunkMarks;
+    size_t m_next {};
+    size_t m_nextPayload {};
+    size_t m_nextChunkMark {};
+    bool m_recording {};
+};
+
+} // namespace Internal
+} // namespace SuitableStruct
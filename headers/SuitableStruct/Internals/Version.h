@@ -81,6 +81,56 @@ struct SSVersionOffset<T, std::enable_if_t<!HasSSVersionOffsetInType<T>::value &
     static constexpr uint8_t value = Handlers<T>::ssVersionOffset;
 };
 
+// Detect ssSegmentPolicy in type
+template<typename T, typename = void>
+struct HasSSSegmentPolicyInType : std::false_type {};
+
+template<typename T>
+struct HasSSSegmentPolicyInType<T, std::void_t<decltype(T::ssSegmentPolicy)>> : std::true_type {};
+
+// Detect ssSegmentPolicy in Handlers
+template<typename T, typename = void>
+struct HasSSSegmentPolicyInHandlers : std::false_type {};
+
+template<typename T>
+struct HasSSSegmentPolicyInHandlers<T, std::void_t<decltype(Handlers<T>::ssSegmentPolicy)>> : std::true_type {};
+
+// Get segment policy of the newest version type (all segments by default)
+template<typename T, typename = void>
+struct SSTypeSegmentPolicy { static constexpr SSSegmentPolicy value {}; };
+
+template<typename T>
+struct SSTypeSegmentPolicy<T, std::enable_if_t<HasSSSegmentPolicyInType<T>::value>> {
+    static constexpr SSSegmentPolicy value = T::ssSegmentPolicy;
+};
+
+template<typename T>
+struct SSTypeSegmentPolicy<T, std::enable_if_t<!HasSSSegmentPolicyInType<T>::value && HasSSSegmentPolicyInHandlers<T>::value>> {
+    static constexpr SSSegmentPolicy value = Handlers<T>::ssSegmentPolicy;
+};
+
+// Detect ssFrameless in type
+template<typename T, typename = void>
+struct HasSSFramelessInType : std::false_type {};
+
+template<typename T>
+struct HasSSFramelessInType<T, std::void_t<decltype(T::ssFrameless)>> : std::true_type {};
+
+// Permanently unversioned type, written without segment framing (false by default).
+// Handlers-based types have custom format, so only the type itself can declare it.
+template<typename T, typename = void>
+struct SSFrameless { static constexpr bool value = false; };
+
+template<typename T>
+struct SSFrameless<T, std::enable_if_t<HasSSFramelessInType<T>::value>> {
+    static constexpr bool value = T::ssFrameless;
+
+    static_assert(!value || (!HasSSVersionsInTypeOrHandlers<T>::value &&
+                             !HasSSVersionOffsetInType<T>::value &&
+                             !HasSSVersionOffsetInHandlers<T>::value),
+                  "ssFrameless type can't be versioned: remove 'ssVersions' / 'ssVersionOffset' or 'ssFrameless'");
+};
+
 template<typename T>
 struct SSVersion
 {
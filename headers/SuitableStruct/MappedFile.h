@@ -0,0 +1,85 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <SuitableStruct/BufferReader.h>
+#include <SuitableStruct/Serializer.h>
+
+namespace SuitableStruct {
+
+// Read-only memory mapping of a whole file.
+// Data is read through the page cache on access, without copying it into a 'Buffer'.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path); // Throws std::system_error
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    void open(const std::string& path); // Throws std::system_error
+    void close();
+
+    bool isOpen() const { return m_isOpen; }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+    // Make sure lifetime of 'MappedFile' is greater than reader's.
+    BufferReader reader() const { return BufferReader(m_data, m_size); }
+
+private:
+    void swap(MappedFile& other) noexcept;
+
+private:
+    const uint8_t* m_data { nullptr };
+    size_t m_size { 0 };
+    bool m_isOpen { false };
+#ifdef _WIN32
+    void* m_fileHandle { nullptr };
+    void* m_mappingHandle { nullptr };
+#endif
+};
+
+// Loads 'obj' directly from the mapped file, see 'ssLoad'.
+// The file is unmapped on return, so 'T' must not contain views ('std::string_view', 'ArrayView');
+// use 'ssLoadMappedWithFile' for such types.
+template<typename T>
+void ssLoadMapped(const std::string& path, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    const MappedFile file(path);
+    ssLoad(file.reader(), obj, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadMappedRet(const std::string& path, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    auto result = construct<T>();
+    ssLoadMapped(path, result, loadMode);
+    return result;
+}
+
+// Object loaded from a mapped file together with the mapping, which keeps its views valid.
+// Moving doesn't remap the file, so views stay valid after moves too.
+template<typename T>
+struct SSMapped
+{
+    MappedFile file;
+    T value;
+};
+
+template<typename T>
+[[nodiscard]] SSMapped<T> ssLoadMappedWithFile(const std::string& path, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    SSMapped<T> result {MappedFile(path), construct<T>()};
+    ssLoad(result.file.reader(), result.value, loadMode);
+    return result;
+}
+
+} // namespace SuitableStruct
@@ -5,11 +5,14 @@
 #pragma once
 #include <cstdint>
 #include <cstring>
+#include <atomic>
 #include <type_traits>
 #include <tuple>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 #include <SuitableStruct/Internals/FwdDeclarations.h>
 #include <SuitableStruct/Internals/Helpers.h>
 #include <SuitableStruct/Internals/Version.h>
@@ -17,7 +20,9 @@
 #include <SuitableStruct/Internals/Common.h>
 #include <SuitableStruct/Exceptions.h>
 #include <SuitableStruct/Buffer.h>
+#include <SuitableStruct/BufferChain.h>
 #include <SuitableStruct/BufferReader.h>
+#include <SuitableStruct/BufferWriter.h>
 #include <SuitableStruct/Handlers.h>
 #include <SuitableStruct/Hashes.h>
 
@@ -37,6 +42,55 @@ namespace Internal {
 constexpr size_t SS_FORMAT_MARK_SIZE = 5;
 extern const uint8_t SS_FORMAT_F0[SS_FORMAT_MARK_SIZE];  // Format F0, single-version, old hash algorithm
 extern const uint8_t SS_FORMAT_F1[SS_FORMAT_MARK_SIZE];  // Format F1, multiple versions segments, new hash algorithm
+extern const uint8_t SS_FORMAT_F2[SS_FORMAT_MARK_SIZE];  // Format F2, same as F1, CRC32C hash
+extern const uint8_t SS_FORMAT_F3[SS_FORMAT_MARK_SIZE];  // Format F3, compact F1 (varints), CRC32C hash
+extern const uint8_t SS_FORMAT_F4[SS_FORMAT_MARK_SIZE];  // Format F4, F1 with chunk-indexed containers, CRC32C hash
+
+// Format mark & envelope hash for saving in 'format' (F1...F4)
+const uint8_t* formatMark(SSDataFormat format);
+uint32_t formatHash(SSDataFormat format, const void* ptr, size_t sz);
+uint32_t formatHashContinue(SSDataFormat format, uint32_t hash, const void* ptr, size_t sz);
+
+// Protected mode header: uint64 size, uint32 hash, format mark
+constexpr size_t SS_PROTECTED_HEADER_SIZE = sizeof(uint64_t) + sizeof(uint32_t) + SS_FORMAT_MARK_SIZE;
+
+// Payload encoding of 'format' for saving or loading: compact (F3) or chunk-indexed (F4)
+class FormatScope {
+public:
+    explicit FormatScope(SSDataFormat format)
+        : m_compactScope(format == SSDataFormat::F3),
+          m_indexedScope(format == SSDataFormat::F4)
+    { }
+
+private:
+    CompactFormatScope m_compactScope;
+    IndexedFormatScope m_indexedScope;
+};
+
+} // namespace Internal
+
+// Verified protected envelope, see 'ssDetectFormatInfo'
+struct SSFormatInfo
+{
+    SSDataFormat format {};
+    size_t payloadOffset {}; // Payload position (after format mark), relative to the envelope start
+    size_t payloadSize {};   // Payload size (without format mark)
+    size_t totalSize {};     // Whole envelope size: header, format mark and payload
+
+    bool operator==(const SSFormatInfo& rhs) const {
+        return format == rhs.format && payloadOffset == rhs.payloadOffset &&
+               payloadSize == rhs.payloadSize && totalSize == rhs.totalSize;
+    }
+
+    bool operator!=(const SSFormatInfo& rhs) const { return !(*this == rhs); }
+};
+
+namespace Internal {
+
+// Parses protected envelope at the current position and moves 'bufferReader' past it.
+// The hash algorithm is selected by format mark, so valid data is hashed once.
+// Throws IntegrityError, FormatError or TooLarge.
+SSFormatInfo readEnvelope(BufferReader& bufferReader, bool verifyHash);
 
 } // namespace Internal
 
@@ -44,8 +98,19 @@ extern const uint8_t SS_FORMAT_F1[SS_FORMAT_MARK_SIZE];  // Format F1, multiple
 [[nodiscard]] std::optional<SSDataFormat> ssDetectFormat(const Buffer& buffer);
 [[nodiscard]] std::optional<SSDataFormat> ssDetectFormat(BufferReader& bufferReader);
 
+// Same as 'ssDetectFormat', but also returns verified payload range.
+// Pass result to 'ssLoad(bufferReader, obj, info)' to load without hashing again.
+[[nodiscard]] std::optional<SSFormatInfo> ssDetectFormatInfo(const Buffer& buffer);
+[[nodiscard]] std::optional<SSFormatInfo> ssDetectFormatInfo(BufferReader& bufferReader);
+
+// Checks hash of protected data, e.g. loaded earlier with 'SSLoadMode::ProtectedTrusted'.
+// Doesn't throw and doesn't move 'bufferReader'.
+[[nodiscard]] bool ssVerify(const Buffer& buffer);
+[[nodiscard]] bool ssVerify(BufferReader& bufferReader);
+
 // ------ Forward declarations ------
 template<typename T> Buffer ssSaveInternal(const T& obj);
+template<typename T> void ssSaveInternal(BufferWriter& writer, const T& obj);
 template<typename T> void ssLoadInternal(BufferReader& bufferReader, T& obj);
 template<typename T> [[nodiscard]] T ssLoadInternalRet(BufferReader& bufferReader);
 
@@ -57,33 +122,55 @@ template<typename T>
 void ssLoadAndConvert(BufferReader& bufferReader, T& obj, const std::optional<uint8_t>& ver);
 // ------ ------
 
+// Frameless types ('ssFrameless = true'): 'ssTuple' members are written inline, without
+// segments count, version & size. Members are self-delimiting, so no other serialization is allowed.
+template<typename T>
+constexpr bool ssIsFrameless()
+{
+    if constexpr (std::is_class_v<T> && SSFrameless<T>::value) {
+        static_assert(can_ssTuple<T>::value && !can_ssSaveImpl<T>::value && !Handlers<T>::value &&
+                      !can_ssLoadImpl<T&, BufferReader&>::value,
+                      "ssFrameless type must be serialized by 'ssTuple'");
+        return true;
+    } else {
+        return false;
+    }
+}
+
+// Detect writer-based 'ssSaveImplTo(BufferWriter&, const T&)' (DefaultTypes or found via ADL)
+template<typename T, typename = void>
+struct can_ssSaveImplTo : std::false_type {};
+
+template<typename T>
+struct can_ssSaveImplTo<T, std::void_t<decltype(ssSaveImplTo(std::declval<BufferWriter&>(), std::declval<const T&>()))>> : std::true_type {};
+
 template<size_t I = 0, typename... Args,
          typename std::enable_if<I == sizeof...(Args)>::type* = nullptr>
-void ssSaveImplViaTuple(Buffer&, const std::tuple<Args...>&)
+void ssSaveImplViaTuple(BufferWriter&, const std::tuple<Args...>&)
 {
 }
 
 template<size_t I = 0, typename... Args,
          typename std::enable_if<!(I >= sizeof...(Args))>::type* = nullptr>
-void ssSaveImplViaTuple(Buffer& buffer, const std::tuple<Args...>& args)
+void ssSaveImplViaTuple(BufferWriter& writer, const std::tuple<Args...>& args)
 {
-    buffer += ssSaveInternal(std::get<I>(args));
-    ssSaveImplViaTuple<I+1>(buffer, args);
+    ssSaveInternal(writer, std::get<I>(args));
+    ssSaveImplViaTuple<I+1>(writer, args);
 }
 
 // Internal tuple save (F1 format - no format markers in recursive calls)
 template<size_t I = 0, typename... Args,
          typename std::enable_if<I == sizeof...(Args)>::type* = nullptr>
-void ssSaveImplViaTupleInternal(Buffer&, const std::tuple<Args...>&)
+void ssSaveImplViaTupleInternal(BufferWriter&, const std::tuple<Args...>&)
 {
 }
 
 template<size_t I = 0, typename... Args,
          typename std::enable_if<!(I >= sizeof...(Args))>::type* = nullptr>
-void ssSaveImplViaTupleInternal(Buffer& buffer, const std::tuple<Args...>& args)
+void ssSaveImplViaTupleInternal(BufferWriter& writer, const std::tuple<Args...>& args)
 {
-    buffer += ssSaveInternal(std::get<I>(args));
-    ssSaveImplViaTupleInternal<I+1>(buffer, args);
+    ssSaveInternal(writer, std::get<I>(args));
+    ssSaveImplViaTupleInternal<I+1>(writer, args);
 }
 
 // Implementation for tuple load
@@ -141,32 +228,14 @@ void ssLoadAndConvertIter2(T& obj, T2&& srcObj)
     static constexpr auto lastTuplePos = std::tuple_size_v<SSVersions_t<T>> - 1;
     static_assert(I <= lastTuplePos, "ssLoadAndConvertIter2: I is out of bounds");
 
-    using TargetType = std::tuple_element_t<I, SSVersions_t<T>>;
-    std::unique_ptr<TargetType> tempObj;
-    auto& target = [&]() -> auto& {
-        if constexpr (I == lastTuplePos) {
-            return obj;
-        } else {
-            tempObj = construct_unique<TargetType>();
-            return *tempObj;
-        }
-    }();
-
-    if constexpr (std::is_same_v<T2, TargetType>) {
-        target = std::forward<T2>(srcObj);
-    } else if constexpr (HasSSUpgradeFromInType<TargetType, T2&&>::value) {
-        target.ssUpgradeFrom(std::forward<T2&&>(srcObj));
-    } else if constexpr (HasSSUpgradeFromInHandlers<TargetType, T2&&>::value) {
-        Handlers<TargetType>::ssUpgradeFrom(std::forward<T2&&>(srcObj), target);
-    } else if constexpr (std::is_convertible_v<T2, TargetType>) {
-        target = static_cast<TargetType>(srcObj);
+    if constexpr (I == lastTuplePos) {
+        ssUpgradeStep(obj, std::forward<T2>(srcObj));
     } else {
-        static_assert(HasSSUpgradeFromInType<TargetType, T2&&>::value || HasSSUpgradeFromInHandlers<TargetType, T2&&>::value,
-                      "ssUpgradeFrom() missing for up-conversion between versions");
-    }
-
-    if constexpr (I < lastTuplePos)
+        // Intermediate versions live on the stack, each step moves the previous one
+        auto target = construct<std::tuple_element_t<I, SSVersions_t<T>>>();
+        ssUpgradeStep(target, std::forward<T2>(srcObj));
         ssLoadAndConvertIter2<I+1>(obj, std::move(target));
+    }
 }
 
 template<size_t I, typename T>
@@ -209,23 +278,13 @@ void ssLoadAndConvert(BufferReader& bufferReader, T& obj, const std::optional<ui
     ssLoadAndConvertIter<0>(bufferReader, obj, tuplePos);
 }
 
-template<size_t Index, typename VersionsTuple, size_t Offset, typename CurrentType>
-void ssSaveAppendSegment(Buffer& part, uint8_t& segmentsWritten, const CurrentType& obj)
+// Makes the object of previous version (if it should be written) and passes it to 'next'
+template<size_t Index, typename VersionsTuple, typename CurrentType, typename Func>
+void ssForPrevSegment(const CurrentType& obj, Func&& next)
 {
     using ThisType = std::tuple_element_t<Index, VersionsTuple>;
-    static_assert(std::is_same_v<ThisType, CurrentType>, "Type mismatch in ssSaveAppendSegment");
-
-    Buffer versionData;
-    ssBeforeSaveImpl(obj);
-    versionData += ssSaveImpl(obj);
-    ssAfterSaveImpl(obj);
-
-    part.write(static_cast<uint8_t>(Index + Offset)); // Wire version index = tuple position + offset
-    part.write(static_cast<uint64_t>(versionData.size()));
-    part += versionData;
-    segmentsWritten++;
+    static_assert(std::is_same_v<ThisType, CurrentType>, "Type mismatch in ssForPrevSegment");
 
-    // Prepare previous version if exists
     if constexpr (Index > 0) {
         using PrevType = std::tuple_element_t<Index - 1, VersionsTuple>;
 
@@ -247,7 +306,7 @@ void ssSaveAppendSegment(Buffer& part, uint8_t& segmentsWritten, const CurrentTy
                 prevObj = static_cast<PrevType>(obj);
             }
 
-            ssSaveAppendSegment<Index - 1, VersionsTuple, Offset>(part, segmentsWritten, prevObj);
+            next(std::as_const(prevObj));
         } else if constexpr (isDeletedDowngrade) {
             // ssDowngradeTo = delete: explicit opt-out, stop writing older segments
         } else {
@@ -259,6 +318,69 @@ void ssSaveAppendSegment(Buffer& part, uint8_t& segmentsWritten, const CurrentTy
     }
 }
 
+namespace Internal {
+
+struct SegmentStart
+{
+    size_t dataPos {};
+    uint64_t size {}; // Compact format only
+};
+
+// Writes segment version and size (placeholder).
+// Compact format: size is written up front as varint, 'payloadSize()' must return exact F3 size
+// of the payload. So the payload is never moved, which would break 'ArrayView' alignment.
+template<typename SizeFunc>
+SegmentStart ssBeginSegment(BufferWriter& writer, uint8_t version, const SizeFunc& payloadSize)
+{
+    writer.write(version);
+
+    if (isCompactFormat()) {
+        const auto sizes = currentSegmentSizes();
+        const auto size = sizes ? sizes->take(payloadSize) : static_cast<uint64_t>(payloadSize());
+        writer.writeVarint(size);
+        return {writer.position(), size};
+    }
+
+    const auto sizePos = writer.writePlaceholder<uint64_t>();
+    return {sizePos + sizeof(uint64_t), 0};
+}
+
+// Patches (checks in compact format) size of the segment started by 'ssBeginSegment'
+inline void ssEndSegment(BufferWriter& writer, const SegmentStart& start)
+{
+    const auto size = static_cast<uint64_t>(writer.position() - start.dataPos);
+
+    if (isCompactFormat()) {
+        if (size != start.size)
+            throwFormat(); // Serialized size doesn't match saved data (e.g. wrong 'ssSerializedSizeImpl')
+    } else {
+        writer.patch(start.dataPos - sizeof(uint64_t), size);
+    }
+}
+
+} // namespace Internal
+
+// Segment policy of current call (see 'Internal::SegmentPolicyScope') limited by policy of 'T'
+template<typename T>
+SSSegmentPolicy ssSegmentPolicy()
+{
+    return Internal::currentSegmentPolicy() & SSTypeSegmentPolicy<T>::value;
+}
+
+// Whether segment preceding segment 'Index' is written. Segments are written from the newest one.
+template<size_t Index, typename VersionsTuple, size_t Offset>
+constexpr bool ssAllowsPrevSegment(const SSSegmentPolicy& policy)
+{
+    if constexpr (Index > 0) {
+        return policy.allows(std::tuple_size_v<VersionsTuple> - Index, Index - 1 + Offset);
+    } else {
+        return false;
+    }
+}
+
+template<size_t Index, typename VersionsTuple, size_t Offset, typename CurrentType>
+void ssSaveAppendSegment(BufferWriter& writer, uint8_t& segmentsWritten, const CurrentType& obj, const SSSegmentPolicy& policy);
+
 template<typename T>
 [[nodiscard]] T ssLoadImplRet(BufferReader& bufferReader)
 {
@@ -306,9 +428,10 @@ template<typename T>
 // Internal serialization functions (no format marker)
 template<typename T,
          typename std::enable_if<can_ssSaveImpl<T>::value>::type* = nullptr>
-Buffer ssSaveImplInternal(const T& obj)
+void ssSaveImplInternal(BufferWriter& writer, const T& obj)
 {
-    return obj.ssSaveImpl();
+    Internal::SegmentSizesScope sizesScope(nullptr); // Custom saver measures own segments
+    writer.write(obj.ssSaveImpl());
 }
 
 template<typename T,
@@ -316,9 +439,10 @@ template<typename T,
              !can_ssSaveImpl<T>::value &&
              Handlers<T>::value
              >::type* = nullptr>
-Buffer ssSaveImplInternal(const T& obj)
+void ssSaveImplInternal(BufferWriter& writer, const T& obj)
 {
-    return Handlers<T>::ssSaveImpl(obj);
+    Internal::SegmentSizesScope sizesScope(nullptr); // Custom saver measures own segments
+    writer.write(Handlers<T>::ssSaveImpl(obj));
 }
 
 template<typename T,
@@ -327,11 +451,27 @@ template<typename T,
              !Handlers<T>::value &&
               can_ssTuple<T>::value
              >::type* = nullptr>
-Buffer ssSaveImplInternal(const T& obj)
+void ssSaveImplInternal(BufferWriter& writer, const T& obj)
 {
-    Buffer buf;
-    ssSaveImplViaTupleInternal(buf, obj.ssTuple());
-    return buf;
+    ssSaveImplViaTupleInternal(writer, obj.ssTuple());
+}
+
+// Fallback for ssSaveImplInternal: when T does not have ssSaveImpl, no Handlers, and no ssTuple.
+// Default types write straight into 'writer'; other 'Buffer ssSaveImpl(...)' overloads are appended.
+template<typename T,
+         typename std::enable_if<
+             !can_ssSaveImpl<T>::value &&
+             !Handlers<T>::value &&
+             !can_ssTuple<T>::value
+         >::type* = nullptr>
+void ssSaveImplInternal(BufferWriter& writer, const T& obj)
+{
+    if constexpr (can_ssSaveImplTo<T>::value) {
+        ssSaveImplTo(writer, obj);
+    } else {
+        Internal::SegmentSizesScope sizesScope(nullptr); // Custom saver measures own segments
+        writer.write(ssSaveImpl(obj));
+    }
 }
 
 // ssSave.  1) Method
@@ -363,281 +503,1075 @@ template<typename T,
 Buffer ssSaveImpl(const T& obj)
 {
     Buffer buf;
-    ssSaveImplViaTuple(buf, obj.ssTuple());
+    BufferWriter writer(buf);
+    ssSaveImplViaTuple(writer, obj.ssTuple());
     return buf;
 }
 
 template<typename T>
-Buffer ssSaveInternal(const T& obj)
+void ssSaveInternal(BufferWriter& writer, const T& obj)
 {
-    Buffer part;
+    if constexpr (std::is_class_v<T> && !ssIsFrameless<T>()) {
+        // Outermost segments of compact save measure sizes of nested ones
+        Internal::SegmentSizes rootSizes;
+        const auto sizes = Internal::currentSegmentSizes();
+        Internal::SegmentSizesScope sizesScope(sizes || !Internal::isCompactFormat() ? sizes : &rootSizes);
 
-    if constexpr (std::is_class_v<T>) {
         // Write placeholder for segment count, then patch after recursion
-        const size_t countOffset = part.size();
-        part.write(static_cast<uint8_t>(0)); // placeholder
+        const auto countPos = writer.writePlaceholder<uint8_t>();
         uint8_t segmentsWritten {};
         constexpr size_t tuplePos = std::tuple_size_v<SSVersions_t<T>> - 1;
         constexpr size_t offset = SSVersionOffset<T>::value;
-        ssSaveAppendSegment<tuplePos, SSVersions_t<T>, offset>(part, segmentsWritten, obj);
-        part.data()[countOffset] = segmentsWritten;
+        ssSaveAppendSegment<tuplePos, SSVersions_t<T>, offset>(writer, segmentsWritten, obj, ssSegmentPolicy<T>());
+        writer.patch(countPos, segmentsWritten);
     } else {
-        // Primitive types
+        // Primitive & frameless types
         ssBeforeSaveImpl(obj);
-        part += ssSaveImpl(obj);
+        ssSaveImplInternal(writer, obj);
         ssAfterSaveImpl(obj);
     }
-
-    return part;
 }
 
+// ------ Serialized size ------
+// Mirrors 'ssSaveInternal' without producing any bytes. Types with fixed layout
+// (fundamentals, enums, single-version ssTuple structs of such types, pairs, tuples,
+// std::array, durations) are folded to a compile-time constant.
+
+// Detect 'size_t ssSerializedSizeImpl(const T&)' (DefaultTypes or found via ADL)
+template<typename T, typename = void>
+struct can_ssSerializedSizeImpl : std::false_type {};
+
 template<typename T>
-Buffer ssSave(const T& obj, bool protectedMode /*= true*/)
-{
-    Buffer part;
+struct can_ssSerializedSizeImpl<T, std::void_t<decltype(ssSerializedSizeImpl(std::declval<const T&>()))>> : std::true_type {};
 
-    // Only write format marker for protected mode (root level)
-    if (protectedMode) {
-        part.writeRaw(static_cast<const void*>(Internal::SS_FORMAT_F1), sizeof(Internal::SS_FORMAT_F1)); // Format mark
-    }
+// Detect 'size_t ssSerializedSizeImpl() const' of types with custom 'ssSaveImpl' method
+template<typename T, typename = void>
+struct HasSSSerializedSizeInType : std::false_type {};
+
+template<typename T>
+struct HasSSSerializedSizeInType<T, std::void_t<decltype(std::declval<const T&>().ssSerializedSizeImpl())>> : std::true_type {};
 
-    // Use internal save logic
-    part += ssSaveInternal(obj);
+// Detect 'static size_t ssSerializedSizeImpl(const T&)' in 'Handlers<T>'
+template<typename T, typename = void>
+struct HasSSSerializedSizeInHandlers : std::false_type {};
 
-    if (protectedMode) {
-        Buffer result;
-        static_assert (sizeof(part.hash()) == sizeof(uint32_t), "Make sure save & load expect same type!");
-        result.write(static_cast<uint64_t>(part.size()));
-        result.write(part.hash());
-        result += part;
-        return result;
+template<typename T>
+struct HasSSSerializedSizeInHandlers<T, std::void_t<decltype(Handlers<T>::ssSerializedSizeImpl(std::declval<const T&>()))>> : std::true_type {};
+
+template<typename T>
+constexpr std::optional<size_t> ssFixedImplSizeInternal()
+{
+    if constexpr (can_ssSaveImpl<T>::value || Handlers<T>::value) {
+        return {}; // Custom serialization, size is unknown
+    } else if constexpr (can_ssTuple<T>::value) {
+        return SSFixedImplSize<decltype(std::declval<const T&>().ssTuple())>::value;
     } else {
-        return part;
+        return SSFixedImplSize<T>::value;
     }
 }
 
-// Internal load functions (no format reading)
+// Fixed size including segment framing, 'nullopt' for variable-sized types
+template<typename T>
+constexpr std::optional<size_t> ssFixedSizeInternal()
+{
+    if constexpr (ssIsFrameless<T>()) {
+        return ssFixedImplSizeInternal<T>();
+    } else if constexpr (std::is_class_v<T>) {
+        // Amount of segments depends on downgrade chain, so only single-version types are fixed
+        if constexpr (std::tuple_size_v<SSVersions_t<T>> == 1 && ssFixedImplSizeInternal<T>().has_value()) {
+            return Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + *ssFixedImplSizeInternal<T>();
+        } else {
+            return {};
+        }
+    } else {
+        return ssFixedImplSizeInternal<T>();
+    }
+}
+
+template<typename T>
+struct SSFixedSize
+{
+    static constexpr bool value = ssFixedSizeInternal<T>().has_value();
+    static constexpr size_t size = ssFixedSizeInternal<T>().value_or(0); // Non-protected mode
+};
+
 template<typename T,
-         typename std::enable_if<can_ssLoadImpl<T&, BufferReader&>::value>::type* = nullptr>
-void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+         typename std::enable_if<can_ssSaveImpl<T>::value>::type* = nullptr>
+size_t ssSerializedSizeImplInternal(const T& obj)
 {
-    obj.ssLoadImpl(bufferReader);
+    if constexpr (HasSSSerializedSizeInType<T>::value) {
+        return obj.ssSerializedSizeImpl();
+    } else {
+        Internal::SegmentSizesScope sizesScope(nullptr);
+        return obj.ssSaveImpl().size(); // Makes the payload
+    }
 }
 
 template<typename T,
          typename std::enable_if<
-             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !can_ssSaveImpl<T>::value &&
              Handlers<T>::value
              >::type* = nullptr>
-void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+size_t ssSerializedSizeImplInternal(const T& obj)
 {
-    Handlers<T>::ssLoadImpl(bufferReader, obj);
+    if constexpr (HasSSSerializedSizeInHandlers<T>::value) {
+        return Handlers<T>::ssSerializedSizeImpl(obj);
+    } else {
+        Internal::SegmentSizesScope sizesScope(nullptr);
+        return Handlers<T>::ssSaveImpl(obj).size(); // Makes the payload
+    }
 }
 
 template<typename T,
          typename std::enable_if<
-             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !can_ssSaveImpl<T>::value &&
              !Handlers<T>::value &&
               can_ssTuple<T>::value
              >::type* = nullptr>
-void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+size_t ssSerializedSizeImplInternal(const T& obj)
 {
-    ssLoadImplViaTupleInternal(bufferReader, const_cast_tuple(obj.ssTuple()));
+    // Sequenced, sizes of nested segments are recorded in order (see 'Internal::SegmentSizes')
+    size_t result {};
+    std::apply([&result](const auto&... xs){ ((result += ssSerializedSizeInternal(xs)), ...); }, obj.ssTuple());
+    return result;
 }
 
-// Fallback for ssLoadImplInternal: when T does not have ssLoadImpl, no Handlers, and no ssTuple
 template<typename T,
          typename std::enable_if<
-             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !can_ssSaveImpl<T>::value &&
              !Handlers<T>::value &&
              !can_ssTuple<T>::value
          >::type* = nullptr>
-void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
-{
-    ssLoadImpl(bufferReader, obj);
-}
-
-// ssLoad.  1) Method
-template<typename T,
-         typename std::enable_if<can_ssLoadImpl<T&, BufferReader&>::value>::type* = nullptr>
-void ssLoadImpl(BufferReader& bufferReader, T& obj)
-{
-    obj.ssLoadImpl(bufferReader);
-}
-
-// ssLoad.  2) Handlers
-template<typename T,
-         typename std::enable_if<
-             !can_ssLoadImpl<T&, BufferReader&>::value &&
-             Handlers<T>::value
-             >::type* = nullptr>
-void ssLoadImpl(BufferReader& bufferReader, T& obj)
+size_t ssSerializedSizeImplInternal(const T& obj)
 {
-    Handlers<T>::ssLoadImpl(bufferReader, obj);
+    if constexpr (can_ssSerializedSizeImpl<T>::value) {
+        return ssSerializedSizeImpl(obj);
+    } else {
+        Internal::SegmentSizesScope sizesScope(nullptr);
+        return ssSaveImpl(obj).size(); // Makes the payload
+    }
 }
 
-// ssLoad.  3) Tuple
-template<typename T,
-         typename std::enable_if<
-             !can_ssLoadImpl<T&, BufferReader&>::value &&
-             !Handlers<T>::value &&
-              can_ssTuple<T>::value
-             >::type* = nullptr>
-void ssLoadImpl(BufferReader& bufferReader, T& obj)
-{
-    ssLoadImplViaTuple(bufferReader, const_cast_tuple(obj.ssTuple()));
-}
+template<typename T>
+constexpr bool ssSavesViaBuffer();
 
+// Size of segment payload. Recorded for the save, if it's measured by 'Internal::SegmentSizes'.
 template<typename T>
-void ssLoad(BufferReader& bufferReader, T& obj, SSLoadMode loadMode)
+size_t ssSerializedSizeSegmentPayload(const T& obj)
 {
-    std::unique_ptr<BufferReader> partBufferReaderPtr;
-    bool isFormatF1 = false;
-
-    BufferReader& partBufferReader = [&bufferReader, loadMode, &partBufferReaderPtr]() -> BufferReader& {
-        if (loadMode == SSLoadMode::Protected) {
-            using HashType = decltype(std::declval<Buffer>().hash());
+    const auto sizes = Internal::currentSegmentSizes();
+    if (!sizes || !sizes->isRecording())
+        return ssSerializedSizeImplInternal(obj);
+
+    const auto slot = sizes->reserve();
+    size_t result {};
+
+    if constexpr (ssSavesViaBuffer<T>()) {
+        // Made once, the save writes it
+        auto payload = [&obj]() {
+            Internal::SegmentSizesScope sizesScope(nullptr);
+            return ssSaveImpl(obj);
+        }();
 
-            if (bufferReader.rest() < sizeof(uint64_t) + sizeof(HashType))
-                Internal::throwIntegrity();
+        result = payload.size();
+        sizes->keepPayload(std::move(payload));
+    } else {
+        result = ssSerializedSizeImplInternal(obj);
+    }
 
-            const auto size = bufferReader.read<uint64_t>();
-            const auto hash = bufferReader.read<HashType>();
+    sizes->set(slot, result);
+    return result;
+}
 
-            if (bufferReader.rest() < size)
-                Internal::throwIntegrity();
+template<size_t Index, typename VersionsTuple, size_t Offset, typename CurrentType>
+void ssSerializedSizeAppendSegment(size_t& result, const CurrentType& obj, const SSSegmentPolicy& policy)
+{
+    const auto segmentSize = ssSerializedSizeSegmentPayload(obj);
+    result += sizeof(uint8_t) + Internal::ssLengthSize(segmentSize); // Version, segment size
+    result += segmentSize;
 
-            if (size > std::numeric_limits<size_t>::max())
-                Internal::throwTooLarge();
+    if (!ssAllowsPrevSegment<Index, VersionsTuple, Offset>(policy))
+        return;
 
-            partBufferReaderPtr = std::make_unique<BufferReader>(bufferReader.readRaw(size));
+    ssForPrevSegment<Index, VersionsTuple>(obj, [&result, &policy](const auto& prevObj) {
+        ssSerializedSizeAppendSegment<Index - 1, VersionsTuple, Offset>(result, prevObj, policy);
+    });
+}
 
-            // Validate hash using new algorithm first, fallback to legacy
-            std::optional<bool> optIsNewAlgo {};
-            if (hash == partBufferReaderPtr->hash()) {
-                optIsNewAlgo = true;
-            } else {
-                // Try legacy hash computation
-                const auto legacyHash = ssHashRaw_F0(partBufferReaderPtr->data(), partBufferReaderPtr->size());
-                if (hash == legacyHash) {
-                    optIsNewAlgo = false;
-                }
-            }
+template<typename T>
+size_t ssSerializedSizeInternal(const T& obj)
+{
+    if constexpr (SSFixedSize<T>::value) {
+        if (!Internal::isCompactFormat())
+            return SSFixedSize<T>::size;
+    }
 
-            if (optIsNewAlgo) { // Any valid format is accepted
-                return *partBufferReaderPtr;
-            } else {
-                Internal::throwIntegrity();
-            }
-        } else {
-            return bufferReader;
-        }
-    }();
+    if constexpr (std::is_class_v<T> && !ssIsFrameless<T>()) {
+        size_t result = sizeof(uint8_t); // Segments count
+        constexpr size_t tuplePos = std::tuple_size_v<SSVersions_t<T>> - 1;
+        ssSerializedSizeAppendSegment<tuplePos, SSVersions_t<T>, SSVersionOffset<T>::value>(result, obj, ssSegmentPolicy<T>());
+        return result;
+    } else {
+        return ssSerializedSizeImplInternal(obj);
+    }
+}
 
-    if (loadMode == SSLoadMode::Protected) {
-        // Read and validate reserved signature only in protected mode
-        uint8_t formatMark[Internal::SS_FORMAT_MARK_SIZE];
-        partBufferReader.readRaw(formatMark, sizeof(formatMark));
+// Whether payload of T is made by 'Buffer ssSaveImpl' before its size is known,
+// i.e. custom savers without 'ssSerializedSizeImpl'
+template<typename T>
+constexpr bool ssSavesViaBuffer()
+{
+    if constexpr (can_ssSaveImpl<T>::value) {
+        return !HasSSSerializedSizeInType<T>::value;
+    } else if constexpr (Handlers<T>::value) {
+        return !HasSSSerializedSizeInHandlers<T>::value;
+    } else {
+        return !can_ssTuple<T>::value && !can_ssSaveImplTo<T>::value && !can_ssSerializedSizeImpl<T>::value;
+    }
+}
 
-        const bool isFormatF0Marker = memcmp(formatMark, Internal::SS_FORMAT_F0, Internal::SS_FORMAT_MARK_SIZE) == 0;
-        const bool isFormatF1Marker = !isFormatF0Marker && (memcmp(formatMark, Internal::SS_FORMAT_F1, Internal::SS_FORMAT_MARK_SIZE) == 0);
+template<size_t Index, typename VersionsTuple, size_t Offset, typename CurrentType>
+void ssSaveAppendSegment(BufferWriter& writer, uint8_t& segmentsWritten, const CurrentType& obj, const SSSegmentPolicy& policy)
+{
+    // Wire version index = tuple position + offset
+    const auto version = static_cast<uint8_t>(Index + Offset);
 
-        if (!isFormatF0Marker && !isFormatF1Marker)
-            Internal::throwFormat();
+    ssBeforeSaveImpl(obj);
 
-        isFormatF1 = isFormatF1Marker;
+    if constexpr (ssSavesViaBuffer<CurrentType>()) {
+        // Payload is made anyway, so its size is known without another save.
+        // Compact format: it could be made already, while measuring the outermost segment.
+        const auto sizes = Internal::currentSegmentSizes();
+        const auto payload = (sizes && sizes->hasPayload()) ? sizes->takePayload() : [&obj]() {
+            Internal::SegmentSizesScope sizesScope(nullptr);
+            return ssSaveImpl(obj);
+        }();
 
+        const auto segment = Internal::ssBeginSegment(writer, version, [&payload](){ return payload.size(); });
+        writer.write(payload);
+        Internal::ssEndSegment(writer, segment);
     } else {
-        isFormatF1 = [loadMode]() {
-            switch (loadMode) {
-                case SSLoadMode::NonProtectedF0Hint: return false;
-                case SSLoadMode::NonProtectedF1Hint: return true;
-                case SSLoadMode::NonProtectedDefault: return !isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false);
-                case SSLoadMode::Protected:
-                    assert(false && "Should never reach here");
-                    return false;
-            }
-
-            assert(false && "Should never reach here");
-            return false;
-        }();
+        const auto segment = Internal::ssBeginSegment(writer, version, [&obj](){ return ssSerializedSizeImplInternal(obj); });
+        ssSaveImplInternal(writer, obj);
+        Internal::ssEndSegment(writer, segment);
     }
 
-    Internal::LegacyFormatScope legacyScope(Internal::FormatType::Binary, !isFormatF1);
-
-    if constexpr (std::is_class_v<T>) {
-        if (isFormatF1) {
-            // Format F1, multiple-version segments, new hash algorithm
-            ssLoadInternal(partBufferReader, obj);
-
-        } else {
-            // Format F0, single-version, old hash algorithm (legacy format)
-            auto temp = construct<T>();
-            ssBeforeLoadImpl(temp);
+    ssAfterSaveImpl(obj);
+    segmentsWritten++;
 
-            uint8_t version {};
-            partBufferReader.read(version);
-            ssLoadAndConvert(partBufferReader, temp, version);
+    // Prepare previous version if exists and is allowed
+    if (!ssAllowsPrevSegment<Index, VersionsTuple, Offset>(policy))
+        return;
 
-            ssAfterLoadImpl(temp);
-            obj = std::move(temp);
-        }
-    } else {
-        // Primitive type
-        auto temp = construct<T>();
-        ssBeforeLoadImpl(temp);
-        ssLoadImpl(partBufferReader, temp);
-        ssAfterLoadImpl(temp);
-        obj = std::move(temp);
-    }
+    ssForPrevSegment<Index, VersionsTuple>(obj, [&writer, &segmentsWritten, &policy](const auto& prevObj) {
+        ssSaveAppendSegment<Index - 1, VersionsTuple, Offset>(writer, segmentsWritten, prevObj, policy);
+    });
 }
 
+// Exact amount of bytes 'ssSave(obj, protectedMode)' produces.
+// Custom savers ('ssSaveImpl' method, 'Handlers', free 'ssSaveImpl') are measured by making their payload,
+// which costs as much as saving it. To avoid that, they can provide the size: 'size_t ssSerializedSizeImpl() const',
+// 'static size_t Handlers<T>::ssSerializedSizeImpl(const T&)' or free 'size_t ssSerializedSizeImpl(const T&)'.
 template<typename T>
-void ssLoad(BufferReader&& bufferReader, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+size_t ssSerializedSize(const T& obj, bool protectedMode /*= true*/)
 {
-    ssLoad(static_cast<BufferReader&>(bufferReader), obj, loadMode);
+    return (protectedMode ? Internal::SS_PROTECTED_HEADER_SIZE : 0) + ssSerializedSizeInternal(obj);
 }
 
+// Exact amount of bytes 'ssSave(obj, format)' produces
 template<typename T>
-void ssLoad(const Buffer& buffer, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+size_t ssSerializedSize(const T& obj, SSDataFormat format)
 {
-    ssLoad(BufferReader(buffer), obj, loadMode);
+    Internal::FormatScope formatScope(format);
+    return Internal::SS_PROTECTED_HEADER_SIZE + ssSerializedSizeInternal(obj);
 }
 
+// Exact amount of bytes 'ssSave(obj, policy, format)' produces
 template<typename T>
-[[nodiscard]] T ssLoadRet(BufferReader& bufferReader, SSLoadMode loadMode/* = SSLoadMode::Protected*/)
+size_t ssSerializedSize(const T& obj, const SSSegmentPolicy& policy, SSDataFormat format = SSDataFormat::F1)
 {
-    auto result = construct<T>();
-    ssLoad(bufferReader, result, loadMode);
-    return result;
+    Internal::SegmentPolicyScope policyScope(policy);
+    return ssSerializedSize(obj, format);
 }
 
 template<typename T>
-[[nodiscard]] T ssLoadRet(BufferReader&& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+constexpr size_t ssFixedSerializedSize(bool protectedMode = true)
 {
-    return ssLoadRet<T>(static_cast<BufferReader&>(bufferReader), loadMode);
+    static_assert(SSFixedSize<T>::value, "ssFixedSerializedSize: T has variable size, use ssSerializedSize(obj)");
+    return (protectedMode ? Internal::SS_PROTECTED_HEADER_SIZE : 0) + SSFixedSize<T>::size;
 }
+// ------ ------
+
+// ------ Validation & skipping ------
+// Walks serialized data of 'T' (F1...F4) using only 'BufferReader' bounds checks:
+// no objects are constructed and nothing is allocated. Mirrors 'ssLoadInternal'.
+template<typename T, typename = void>
+struct can_ssValidateImpl : std::false_type {};
 
 template<typename T>
-[[nodiscard]] T ssLoadRet(const Buffer& buffer, SSLoadMode loadMode = SSLoadMode::Protected)
+struct can_ssValidateImpl<T, std::void_t<decltype(ssValidateImpl(std::declval<BufferReader&>(), SSTypeTag<T>{}))>> : std::true_type {};
+
+template<typename Tuple, size_t... Is>
+void ssValidateTupleMembers(BufferReader& bufferReader, std::index_sequence<Is...>)
 {
-    return ssLoadRet<T>(BufferReader(buffer), loadMode);
+    (ssValidateInternal<std::decay_t<std::tuple_element_t<Is, Tuple>>>(bufferReader), ...);
 }
 
-// Internal load function for F1 format (no format markers)
+// Custom format: only segment bounds are known. Validation before in-place load (see 'ssLoadInPlace')
+// loads it into a fresh object, because a failure after the target is partially overwritten can't be undone.
 template<typename T>
-void ssLoadInternal(BufferReader& bufferReader, T& obj)
+void ssValidateCustomSegment(BufferReader& bufferReader)
 {
-    // If we're in F0 format mode, use the F0 logic instead
-    if (Internal::isProcessingLegacyFormat(Internal::FormatType::Binary)) {
-        obj = ssLoadInternalRet<T>(bufferReader);
-        return;
+    if (Internal::isLoadingInPlace()) {
+        auto temp = construct<T>();
+        ssLoadImplInternal(bufferReader, temp);
     }
+}
 
-    auto temp = construct<T>();
-    ssBeforeLoadImpl(temp);
+// Validates content of a single segment of 'T'
+template<typename T>
+void ssValidateImplInternal(BufferReader& bufferReader)
+{
+    if constexpr (can_ssSaveImpl<T>::value || Handlers<T>::value) {
+        ssValidateCustomSegment<T>(bufferReader);
+    } else if constexpr (can_ssTuple<T>::value) {
+        using Tuple = std::decay_t<decltype(std::declval<const T&>().ssTuple())>;
+        ssValidateTupleMembers<Tuple>(bufferReader, std::make_index_sequence<std::tuple_size_v<Tuple>>());
+    } else if constexpr (can_ssValidateImpl<T>::value) {
+        ssValidateImpl(bufferReader, SSTypeTag<T>{});
+    } else {
+        // Type with custom free 'ssLoadImpl'
+        ssValidateCustomSegment<T>(bufferReader);
+    }
+}
+
+template<typename VersionsTuple, size_t Offset, size_t I = 0>
+void ssValidateVersionSegment(BufferReader& bufferReader, uint8_t version)
+{
+    if constexpr (I < std::tuple_size_v<VersionsTuple>) {
+        if (version == I + Offset) {
+            ssValidateImplInternal<std::tuple_element_t<I, VersionsTuple>>(bufferReader);
+        } else {
+            ssValidateVersionSegment<VersionsTuple, Offset, I + 1>(bufferReader, version);
+        }
+    } else {
+        Internal::throwVersionError();
+    }
+}
+
+template<typename T>
+void ssValidateInternal(BufferReader& bufferReader)
+{
+    using U = std::remove_cv_t<T>;
+
+    if constexpr (ssIsFrameless<U>()) {
+        ssValidateImplInternal<U>(bufferReader);
+
+    } else if constexpr (std::is_class_v<U>) {
+        const auto segmentsCount = bufferReader.read<uint8_t>();
+        bool validated = false;
+
+        // The segment which would be loaded is validated (see 'ssLoadInternalInto'), others are only bounds-checked
+        for (uint8_t i = 0; i < segmentsCount; i++) {
+            const auto storedVersion = bufferReader.read<uint8_t>();
+            const auto segmentSize = Internal::ssReadLength(bufferReader);
+            auto segmentData = bufferReader.readRaw(segmentSize);
+
+            if (!validated && storedVersion <= SSVersion<U>::value) {
+                ssValidateVersionSegment<SSVersions_t<U>, SSVersionOffset<U>::value>(segmentData, storedVersion);
+                validated = true;
+            }
+        }
+
+        if (!validated)
+            Internal::throwVersionError();
+
+    } else {
+        Internal::ssSkipPrimitive<U>(bufferReader);
+    }
+}
+
+template<typename Tuple, size_t... Is>
+void ssSkipTupleMembers(BufferReader& bufferReader, std::index_sequence<Is...>)
+{
+    (ssSkipInternal<std::decay_t<std::tuple_element_t<Is, Tuple>>>(bufferReader), ...);
+}
+
+// Moves 'bufferReader' past serialized 'T' by segment framing, in constant work per class.
+// Frameless types are skipped member by member.
+template<typename T>
+void ssSkipInternal(BufferReader& bufferReader)
+{
+    using U = std::remove_cv_t<T>;
+
+    if constexpr (ssIsFrameless<U>()) {
+        using Tuple = std::decay_t<decltype(std::declval<const U&>().ssTuple())>;
+        ssSkipTupleMembers<Tuple>(bufferReader, std::make_index_sequence<std::tuple_size_v<Tuple>>());
+
+    } else if constexpr (std::is_class_v<U>) {
+        const auto segmentsCount = bufferReader.read<uint8_t>();
+
+        for (uint8_t i = 0; i < segmentsCount; i++) {
+            bufferReader.advance(1); // Version
+            const auto segmentSize = Internal::ssReadLength(bufferReader);
+            bufferReader.readRaw(segmentSize);
+        }
+    } else {
+        Internal::ssSkipPrimitive<U>(bufferReader);
+    }
+}
+
+// Moves 'bufferReader' past serialized 'T' without decoding it. Throws on malformed data.
+// Protected data: envelope is parsed, hash isn't checked. F0 data can't be skipped (FormatError).
+template<typename T>
+void ssSkip(BufferReader& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+        (void)Internal::readEnvelope(bufferReader, false);
+        return;
+    }
+
+    if (loadMode == SSLoadMode::NonProtectedF0Hint ||
+        (loadMode == SSLoadMode::NonProtectedDefault && isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false)))
+        Internal::throwFormat();
+
+    ssSkipInternal<T>(bufferReader);
+}
+
+// Checks that data can be loaded as 'T' without constructing it: envelope and hash (protected modes),
+// segment counts & sizes, container and string lengths, variant indexes, flags.
+// Types with custom serialization are checked by their segment bounds only; F0 data by hash only.
+// Doesn't throw and doesn't move 'bufferReader'.
+template<typename T>
+[[nodiscard]] bool ssValidate(BufferReader& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    const auto originalPosition = bufferReader.position();
+
+    try {
+        if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+            const auto info = Internal::readEnvelope(bufferReader, loadMode == SSLoadMode::Protected);
+
+            if (info.format != SSDataFormat::F0) {
+                BufferReader envelopeReader(bufferReader);
+                envelopeReader.seek(originalPosition + info.payloadOffset);
+                auto payloadReader = envelopeReader.readRaw(info.payloadSize);
+                Internal::FormatScope formatScope(info.format);
+                ssValidateInternal<T>(payloadReader);
+            }
+        } else {
+            if (loadMode == SSLoadMode::NonProtectedF0Hint)
+                Internal::throwFormat();
+
+            ssValidateInternal<T>(bufferReader);
+        }
+    } catch (...) {
+        bufferReader.seek(originalPosition);
+        return false;
+    }
+
+    bufferReader.seek(originalPosition);
+    return true;
+}
+
+template<typename T>
+[[nodiscard]] bool ssValidate(const Buffer& buffer, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    return ssValidate<T>(reader, loadMode);
+}
+
+template<typename T>
+Buffer ssSaveInternal(const T& obj)
+{
+    Buffer part;
+    BufferWriter writer(part);
+    ssSaveInternal(writer, obj);
+    return part;
+}
+
+// Serializes 'obj' into 'writer' in a single pass, protected with 'format' envelope (F1...F4).
+// The size & hash header is written as placeholder and patched once the payload is complete.
+template<typename T>
+void ssSaveTo(BufferWriter& writer, const T& obj, SSDataFormat format)
+{
+    const auto mark = Internal::formatMark(format);
+
+    static_assert (sizeof(Internal::formatHash(format, nullptr, 0)) == sizeof(uint32_t), "Make sure save & load expect same type!");
+    const auto sizePos = writer.writePlaceholder<uint64_t>();
+    const auto hashPos = writer.writePlaceholder<uint32_t>();
+    const auto payloadPos = writer.position();
+
+    writer.writeRaw(static_cast<const void*>(mark), Internal::SS_FORMAT_MARK_SIZE); // Format mark
+
+    {
+        Internal::FormatScope formatScope(format);
+        ssSaveInternal(writer, obj);
+    }
+
+    const auto payloadSize = writer.position() - payloadPos;
+    auto hash = Internal::formatHash(format, nullptr, 0);
+    writer.forEachPart(payloadPos, payloadSize, [format, &hash](const uint8_t* data, size_t size) {
+        hash = Internal::formatHashContinue(format, hash, data, size);
+    });
+
+    writer.patch(sizePos, static_cast<uint64_t>(payloadSize));
+    writer.patch(hashPos, hash);
+}
+
+// Serializes 'obj' into 'writer' in a single pass. Protected mode uses F1 envelope.
+template<typename T>
+void ssSaveTo(BufferWriter& writer, const T& obj, bool protectedMode /*= true*/)
+{
+    if (!protectedMode) {
+        ssSaveInternal(writer, obj);
+        return;
+    }
+
+    ssSaveTo(writer, obj, SSDataFormat::F1);
+}
+
+// Appends to 'buffer'. Reusing one buffer for many saves (with 'Buffer::clear' in between)
+// reuses its capacity instead of allocating each time.
+template<typename T>
+void ssSaveTo(Buffer& buffer, const T& obj, SSDataFormat format)
+{
+    if constexpr (SSFixedSize<T>::value)
+        buffer.reserve(buffer.size() + ssFixedSerializedSize<T>());
+
+    BufferWriter writer(buffer);
+    ssSaveTo(writer, obj, format);
+}
+
+template<typename T>
+void ssSaveTo(Buffer& buffer, const T& obj, bool protectedMode = true)
+{
+    if constexpr (SSFixedSize<T>::value)
+        buffer.reserve(buffer.size() + ssFixedSerializedSize<T>(protectedMode));
+
+    BufferWriter writer(buffer);
+    ssSaveTo(writer, obj, protectedMode);
+}
+
+namespace Internal {
+
+// Recent sizes of protected 'ssSave' results for T, shared by all threads.
+// Kept per payload layout: F0...F2 differ only in hash, F3 & F4 are smaller & larger.
+template<typename T>
+struct SizeHint
+{
+    static inline std::atomic<size_t> values[3] {};
+};
+
+constexpr size_t sizeHintSlot(SSDataFormat format)
+{
+    return format == SSDataFormat::F3 ? 1 : format == SSDataFormat::F4 ? 2 : 0;
+}
+
+// Moving average of sizes (1/4 weight of the latest one). Rounded towards 'size',
+// so steady-state saves of the same size fit exactly.
+constexpr size_t nextSizeHint(size_t hint, size_t size)
+{
+    if (!hint)
+        return size;
+
+    return size >= hint ? hint + (size - hint + 3) / 4 : hint - (hint - size) / 4;
+}
+
+// Pre-reserves root buffer: exact size for fixed-size types, learned estimate for others
+template<typename T>
+void reserveForSave(Buffer& buffer, bool protectedMode, SSDataFormat format = SSDataFormat::F1)
+{
+    if constexpr (SSFixedSize<T>::value) {
+        buffer.reserve(ssFixedSerializedSize<T>(protectedMode));
+    } else {
+        const auto hint = SizeHint<T>::values[sizeHintSlot(format)].load(std::memory_order_relaxed);
+        if (hint > SS_PROTECTED_HEADER_SIZE)
+            buffer.reserve(hint - (protectedMode ? 0 : SS_PROTECTED_HEADER_SIZE));
+    }
+}
+
+// Learns result size. Capacity reserved for a larger estimate is kept: releasing it costs a
+// reallocation & copy per save, and the estimate decays towards smaller sizes by itself.
+template<typename T>
+void learnSaveSize(Buffer& buffer, bool protectedMode, SSDataFormat format = SSDataFormat::F1)
+{
+    if constexpr (!SSFixedSize<T>::value) {
+        const auto size = buffer.size() + (protectedMode ? 0 : SS_PROTECTED_HEADER_SIZE);
+        auto& hint = SizeHint<T>::values[sizeHintSlot(format)];
+        hint.store(nextSizeHint(hint.load(std::memory_order_relaxed), size), std::memory_order_relaxed);
+    }
+}
+
+} // namespace Internal
+
+// Estimate of protected 'ssSave' result size for T in 'format', learned from previous saves (0 if unknown).
+// Saves pre-reserve the result buffer with it, so steady-state saves allocate once.
+// Can be stored and seeded with 'ssSetSizeHint' on the next run.
+template<typename T>
+[[nodiscard]] size_t ssSizeHint(SSDataFormat format = SSDataFormat::F1)
+{
+    return Internal::SizeHint<T>::values[Internal::sizeHintSlot(format)].load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void ssSetSizeHint(size_t bytes, SSDataFormat format = SSDataFormat::F1)
+{
+    Internal::SizeHint<T>::values[Internal::sizeHintSlot(format)].store(bytes, std::memory_order_relaxed);
+}
+
+template<typename T>
+Buffer ssSave(const T& obj, bool protectedMode /*= true*/)
+{
+    Buffer result;
+    Internal::reserveForSave<T>(result, protectedMode);
+
+    BufferWriter writer(result);
+    ssSaveTo(writer, obj, protectedMode);
+    Internal::learnSaveSize<T>(result, protectedMode);
+    return result;
+}
+
+// Protected save in 'format' (F1...F4). F2 is faster to hash, F3 is smaller, F4 can be loaded
+// in parallel (see 'SSParallelLoad'); they can't be read by older versions.
+template<typename T>
+Buffer ssSave(const T& obj, SSDataFormat format)
+{
+    Buffer result;
+    Internal::reserveForSave<T>(result, true, format);
+
+    BufferWriter writer(result);
+    ssSaveTo(writer, obj, format);
+    Internal::learnSaveSize<T>(result, true, format);
+    return result;
+}
+
+// Protected save into a buffer allocating from 'resource'
+template<typename T>
+Buffer ssSave(const T& obj, std::pmr::memory_resource* resource, SSDataFormat format = SSDataFormat::F1)
+{
+    Buffer result(resource);
+    Internal::reserveForSave<T>(result, true, format);
+
+    BufferWriter writer(result);
+    ssSaveTo(writer, obj, format);
+    Internal::learnSaveSize<T>(result, true, format);
+    return result;
+}
+
+// Protected save writing only segments allowed by 'policy' (and by 'ssSegmentPolicy' of each type),
+// e.g. 'SSSegmentPolicy::latest(2)' for N-1 compatibility. Nested saves inherit the policy.
+template<typename T>
+Buffer ssSave(const T& obj, const SSSegmentPolicy& policy, SSDataFormat format = SSDataFormat::F1)
+{
+    Internal::SegmentPolicyScope policyScope(policy);
+    return ssSave(obj, format);
+}
+
+template<typename T>
+void ssSaveTo(BufferWriter& writer, const T& obj, const SSSegmentPolicy& policy, SSDataFormat format = SSDataFormat::F1)
+{
+    Internal::SegmentPolicyScope policyScope(policy);
+    ssSaveTo(writer, obj, format);
+}
+
+// Protected save with large random access containers saved by several threads, see 'SSParallelSave'.
+// Custom savers and 'ssBeforeSaveImpl' / 'ssAfterSaveImpl' of container items must be safe to call concurrently.
+template<typename T>
+Buffer ssSave(const T& obj, const SSParallelSave& parallel, SSDataFormat format = SSDataFormat::F1)
+{
+    Internal::ParallelSaveScope parallelScope(parallel);
+    return ssSave(obj, format);
+}
+
+template<typename T>
+void ssSaveTo(BufferWriter& writer, const T& obj, const SSParallelSave& parallel, SSDataFormat format = SSDataFormat::F1)
+{
+    Internal::ParallelSaveScope parallelScope(parallel);
+    ssSaveTo(writer, obj, format);
+}
+
+// Protected save into refcounted chunks instead of a single buffer. Payloads of at least
+// 'sharedThreshold' bytes are referenced rather than copied: 'QByteArray' (implicitly shared) and
+// strings / byte containers owned by 'std::shared_ptr'. Such pointees must not be modified while the chain is in use.
+// Result is the same data as 'ssSave(obj, format)', see 'BufferChain::iovecs' for 'writev'.
+template<typename T>
+[[nodiscard]] BufferChain ssSaveChain(const T& obj, SSDataFormat format = SSDataFormat::F1,
+                                      size_t sharedThreshold = BufferWriter::DefaultSharedThreshold)
+{
+    Buffer buffer;
+    BufferWriter writer(buffer, sharedThreshold);
+    ssSaveTo(writer, obj, format);
+    return writer.takeChain();
+}
+
+// Internal load functions (no format reading)
+template<typename T,
+         typename std::enable_if<can_ssLoadImpl<T&, BufferReader&>::value>::type* = nullptr>
+void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+{
+    obj.ssLoadImpl(bufferReader);
+}
+
+template<typename T,
+         typename std::enable_if<
+             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             Handlers<T>::value
+             >::type* = nullptr>
+void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+{
+    Handlers<T>::ssLoadImpl(bufferReader, obj);
+}
+
+template<typename T,
+         typename std::enable_if<
+             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !Handlers<T>::value &&
+              can_ssTuple<T>::value
+             >::type* = nullptr>
+void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+{
+    ssLoadImplViaTupleInternal(bufferReader, const_cast_tuple(obj.ssTuple()));
+}
+
+// Fallback for ssLoadImplInternal: when T does not have ssLoadImpl, no Handlers, and no ssTuple
+template<typename T,
+         typename std::enable_if<
+             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !Handlers<T>::value &&
+             !can_ssTuple<T>::value
+         >::type* = nullptr>
+void ssLoadImplInternal(BufferReader& bufferReader, T& obj)
+{
+    ssLoadImpl(bufferReader, obj);
+}
+
+// ssLoad.  1) Method
+template<typename T,
+         typename std::enable_if<can_ssLoadImpl<T&, BufferReader&>::value>::type* = nullptr>
+void ssLoadImpl(BufferReader& bufferReader, T& obj)
+{
+    obj.ssLoadImpl(bufferReader);
+}
+
+// ssLoad.  2) Handlers
+template<typename T,
+         typename std::enable_if<
+             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             Handlers<T>::value
+             >::type* = nullptr>
+void ssLoadImpl(BufferReader& bufferReader, T& obj)
+{
+    Handlers<T>::ssLoadImpl(bufferReader, obj);
+}
+
+// ssLoad.  3) Tuple
+template<typename T,
+         typename std::enable_if<
+             !can_ssLoadImpl<T&, BufferReader&>::value &&
+             !Handlers<T>::value &&
+              can_ssTuple<T>::value
+             >::type* = nullptr>
+void ssLoadImpl(BufferReader& bufferReader, T& obj)
+{
+    ssLoadImplViaTuple(bufferReader, const_cast_tuple(obj.ssTuple()));
+}
+
+// Loads payload which follows the format mark (or raw data in non-protected mode)
+template<typename T>
+void ssLoadPayload(BufferReader& bufferReader, T& obj, bool isFormatF1)
+{
+    Internal::LegacyFormatScope legacyScope(Internal::FormatType::Binary, !isFormatF1);
 
     if constexpr (std::is_class_v<T>) {
+        if (isFormatF1) {
+            // Format F1...F4, multiple-version segments
+            ssLoadInternal(bufferReader, obj);
+
+        } else {
+            // Format F0, single-version, old hash algorithm (legacy format)
+            auto temp = construct<T>();
+            ssBeforeLoadImpl(temp);
+
+            uint8_t version {};
+            bufferReader.read(version);
+            ssLoadAndConvert(bufferReader, temp, version);
+
+            ssAfterLoadImpl(temp);
+            obj = std::move(temp);
+        }
+    } else {
+        // Primitive type
+        auto temp = construct<T>();
+        ssBeforeLoadImpl(temp);
+        ssLoadImpl(bufferReader, temp);
+        ssAfterLoadImpl(temp);
+        obj = std::move(temp);
+    }
+}
+
+// Loads protected data, which starts at 'envelopeStart' of 'bufferReader' and is described by 'info'
+template<typename T>
+void ssLoadEnvelope(BufferReader& bufferReader, T& obj, size_t envelopeStart, const SSFormatInfo& info)
+{
+    BufferReader envelopeReader(bufferReader);
+    envelopeReader.seek(envelopeStart + info.payloadOffset);
+    auto payloadReader = envelopeReader.readRaw(info.payloadSize);
+    Internal::FormatScope formatScope(info.format);
+    ssLoadPayload(payloadReader, obj, info.format != SSDataFormat::F0);
+}
+
+template<typename T>
+void ssLoad(BufferReader& bufferReader, T& obj, SSLoadMode loadMode)
+{
+    if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+        const auto envelopeStart = bufferReader.position();
+        const auto info = Internal::readEnvelope(bufferReader, loadMode == SSLoadMode::Protected);
+        ssLoadEnvelope(bufferReader, obj, envelopeStart, info);
+        return;
+    }
+
+    const bool isFormatF1 = [loadMode]() {
+        switch (loadMode) {
+            case SSLoadMode::NonProtectedF0Hint: return false;
+            case SSLoadMode::NonProtectedF1Hint: return true;
+            case SSLoadMode::NonProtectedDefault: return !isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false);
+            case SSLoadMode::Protected:
+            case SSLoadMode::ProtectedTrusted:
+                assert(false && "Should never reach here");
+                return false;
+        }
+
+        assert(false && "Should never reach here");
+        return false;
+    }();
+
+    ssLoadPayload(bufferReader, obj, isFormatF1);
+}
+
+// Loads protected data already verified by 'ssDetectFormatInfo', without hashing it again.
+// 'bufferReader' must be at the same position as it was passed to 'ssDetectFormatInfo'.
+template<typename T>
+void ssLoad(BufferReader& bufferReader, T& obj, const SSFormatInfo& info)
+{
+    const auto envelopeStart = bufferReader.position();
+    const auto actualInfo = Internal::readEnvelope(bufferReader, false);
+
+    if (actualInfo != info)
+        Internal::throwIntegrity();
+
+    ssLoadEnvelope(bufferReader, obj, envelopeStart, info);
+}
+
+template<typename T>
+void ssLoad(BufferReader&& bufferReader, T& obj, const SSFormatInfo& info)
+{
+    ssLoad(static_cast<BufferReader&>(bufferReader), obj, info);
+}
+
+template<typename T>
+void ssLoad(const Buffer& buffer, T& obj, const SSFormatInfo& info)
+{
+    ssLoad(BufferReader(buffer), obj, info);
+}
+
+template<typename T>
+void ssLoad(BufferReader&& bufferReader, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    ssLoad(static_cast<BufferReader&>(bufferReader), obj, loadMode);
+}
+
+template<typename T>
+void ssLoad(const Buffer& buffer, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    ssLoad(BufferReader(buffer), obj, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(BufferReader& bufferReader, SSLoadMode loadMode/* = SSLoadMode::Protected*/)
+{
+    auto result = construct<T>();
+    ssLoad(bufferReader, result, loadMode);
+    return result;
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(BufferReader&& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    return ssLoadRet<T>(static_cast<BufferReader&>(bufferReader), loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(const Buffer& buffer, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    return ssLoadRet<T>(BufferReader(buffer), loadMode);
+}
+
+// Loads with objects created by the loader (result, containers' items, temporaries, strings)
+// allocating from 'resource', if they are allocator-aware (e.g. 'std::pmr::vector', 'std::pmr::string'
+// or structs with 'std::pmr::polymorphic_allocator' as 'allocator_type').
+// 'resource' must outlive the loaded data, e.g. a request-scoped 'std::pmr::monotonic_buffer_resource'.
+template<typename T>
+void ssLoad(BufferReader& bufferReader, T& obj, std::pmr::memory_resource* resource, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    Internal::MemoryResourceScope resourceScope(resource);
+    ssLoad(bufferReader, obj, loadMode);
+}
+
+template<typename T>
+void ssLoad(const Buffer& buffer, T& obj, std::pmr::memory_resource* resource, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    ssLoad(reader, obj, resource, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(BufferReader& bufferReader, std::pmr::memory_resource* resource, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    Internal::MemoryResourceScope resourceScope(resource);
+    return ssLoadRet<T>(bufferReader, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(const Buffer& buffer, std::pmr::memory_resource* resource, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    return ssLoadRet<T>(reader, resource, loadMode);
+}
+
+// Loads containers indexed by format F4 on several threads, see 'SSParallelLoad'. Custom loaders
+// and 'ssBeforeLoadImpl' / 'ssAfterLoadImpl' of container items must be safe to call concurrently.
+template<typename T>
+void ssLoad(BufferReader& bufferReader, T& obj, const SSParallelLoad& parallel, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    Internal::ParallelLoadScope parallelScope(parallel);
+    ssLoad(bufferReader, obj, loadMode);
+}
+
+template<typename T>
+void ssLoad(const Buffer& buffer, T& obj, const SSParallelLoad& parallel, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    ssLoad(reader, obj, parallel, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(BufferReader& bufferReader, const SSParallelLoad& parallel, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    Internal::ParallelLoadScope parallelScope(parallel);
+    return ssLoadRet<T>(bufferReader, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] T ssLoadRet(const Buffer& buffer, const SSParallelLoad& parallel, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    return ssLoadRet<T>(reader, parallel, loadMode);
+}
+
+namespace Internal {
+// Item 'index' of container 'C' framed as a root object, see 'ssLoadItem'
+template<typename C>
+auto ssLoadRootItem(BufferReader& bufferReader, size_t index)
+{
+    Internal::LegacyFormatScope legacyScope(Internal::FormatType::Binary, false);
+    const auto segmentsCount = bufferReader.read<uint8_t>();
+
+    for (uint8_t i = 0; i < segmentsCount; i++) {
+        const auto storedVersion = bufferReader.read<uint8_t>();
+        const auto segmentSize = Internal::ssReadLength(bufferReader);
+        auto segmentData = bufferReader.readRaw(segmentSize);
+
+        if (storedVersion == SSVersion<C>::value)
+            return ssLoadContainerItem<C>(segmentData, index);
+    }
+
+    Internal::throwVersionError();
+}
+} // namespace Internal
+
+// Loads item 'index' of container 'C' saved by 'ssSave', without loading other items.
+// Format F4 reaches it by chunk index, others skip preceding items one by one by their framing
+// (or by size, if items are fixed-sized). Protected mode still hashes the whole data,
+// 'SSLoadMode::ProtectedTrusted' doesn't. F0 data isn't supported. Moves 'bufferReader' past the container.
+template<typename C>
+[[nodiscard]] auto ssLoadItem(BufferReader& bufferReader, size_t index, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    static_assert(IsContainer<C>::value, "ssLoadItem: C should be a container");
+
+    if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+        const auto envelopeStart = bufferReader.position();
+        const auto info = Internal::readEnvelope(bufferReader, loadMode == SSLoadMode::Protected);
+
+        if (info.format == SSDataFormat::F0)
+            Internal::throwFormat();
+
+        BufferReader envelopeReader(bufferReader);
+        envelopeReader.seek(envelopeStart + info.payloadOffset);
+        auto payloadReader = envelopeReader.readRaw(info.payloadSize);
+        Internal::FormatScope formatScope(info.format);
+        return Internal::ssLoadRootItem<C>(payloadReader, index);
+    }
+
+    if (loadMode == SSLoadMode::NonProtectedF0Hint ||
+        (loadMode == SSLoadMode::NonProtectedDefault && isProcessingLegacyFormatOpt(Internal::FormatType::Binary).value_or(false)))
+        Internal::throwFormat();
+
+    BufferReader containerReader(bufferReader);
+    auto result = Internal::ssLoadRootItem<C>(containerReader, index);
+    ssSkipInternal<C>(bufferReader);
+    return result;
+}
+
+template<typename C>
+[[nodiscard]] auto ssLoadItem(const Buffer& buffer, size_t index, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    BufferReader reader(buffer);
+    return ssLoadItem<C>(reader, index, loadMode);
+}
+
+// Types loaded by the library itself (ssTuple, default types) overwrite all their data,
+// so they can be decoded straight into an existing object. Custom loaders get a fresh one.
+template<typename T>
+constexpr bool canLoadInPlace_v =
+    std::is_class_v<T> &&
+    !can_ssLoadImpl<T&, BufferReader&>::value &&
+    !Handlers<T>::value;
+
+template<typename T>
+void ssLoadInternalInto(BufferReader& bufferReader, T& temp);
+
+// Internal load function for F1 format (no format markers)
+template<typename T>
+void ssLoadInternal(BufferReader& bufferReader, T& obj)
+{
+    // If we're in F0 format mode, use the F0 logic instead
+    if (Internal::isProcessingLegacyFormat(Internal::FormatType::Binary)) {
+        obj = ssLoadInternalRet<T>(bufferReader);
+        return;
+    }
+
+    if constexpr (canLoadInPlace_v<T>) {
+        if (Internal::isLoadingInPlace()) {
+            ssLoadInternalInto(bufferReader, obj);
+            return;
+        }
+    }
+
+    auto temp = construct<T>();
+    ssLoadInternalInto(bufferReader, temp);
+    obj = std::move(temp);
+}
+
+// Loads F1 data into 'temp', which is either a fresh object or, in in-place mode, the target one
+template<typename T>
+void ssLoadInternalInto(BufferReader& bufferReader, T& temp)
+{
+    ssBeforeLoadImpl(temp);
+
+    if constexpr (ssIsFrameless<T>()) {
+        ssLoadImplInternal(bufferReader, temp);
+
+    } else if constexpr (std::is_class_v<T>) {
         uint8_t segmentsCount {};
         bufferReader.read(segmentsCount);
 
@@ -649,7 +1583,7 @@ void ssLoadInternal(BufferReader& bufferReader, T& obj)
         for (i = 0; i < segmentsCount; ++i) {
             uint8_t storedVersion {};
             bufferReader.read(storedVersion);
-            const auto segmentSize = bufferReader.read<uint64_t>();
+            const auto segmentSize = Internal::ssReadLength(bufferReader);
             auto segmentData = bufferReader.readRaw(segmentSize);
 
             if (!loaded) {
@@ -661,6 +1595,10 @@ void ssLoadInternal(BufferReader& bufferReader, T& obj)
 
                 } else if (storedVersion < desiredVersion) {
                     // The highest version is less than desired version, upgrade it.
+                    // Upgrade functions expect a fresh object.
+                    if (Internal::isLoadingInPlace())
+                        temp = construct<T>();
+
                     ssLoadAndConvert(segmentData, temp, storedVersion);
                     loaded = true;
                     break;
@@ -674,7 +1612,7 @@ void ssLoadInternal(BufferReader& bufferReader, T& obj)
 
         for (++i; i < segmentsCount; ++i) { // Skip remaining segments
             bufferReader.advance(1); // stored version
-            const auto segmentSize = bufferReader.read<uint64_t>();
+            const auto segmentSize = Internal::ssReadLength(bufferReader);
             bufferReader.advance(segmentSize);
         }
 
@@ -687,7 +1625,229 @@ void ssLoadInternal(BufferReader& bufferReader, T& obj)
     }
 
     ssAfterLoadImpl(temp);
-    obj = std::move(temp);
 }
 
+// Decodes straight into 'obj', reusing capacity of its strings and containers, so repeated loads
+// of the same type don't allocate in steady state. Strong guarantee: data is validated (see 'ssValidate';
+// parts with custom loaders are loaded into fresh objects) before 'obj' is touched.
+// Invalid data is loaded into a fresh object to throw the same error as 'ssLoad'.
+template<typename T>
+void ssLoadInPlace(BufferReader& bufferReader, T& obj, SSLoadMode loadMode /*= SSLoadMode::Protected*/)
+{
+    Internal::InPlaceLoadScope inPlaceScope(true);
+
+    // Hash is checked by 'ssLoad' before decoding
+    const auto validateMode = (loadMode == SSLoadMode::Protected) ? SSLoadMode::ProtectedTrusted : loadMode;
+
+    if (!ssValidate<T>(bufferReader, validateMode)) {
+        Internal::InPlaceLoadScope freshScope(false);
+        auto result = construct<T>();
+        ssLoad(bufferReader, result, loadMode);
+        obj = std::move(result);
+        return;
+    }
+
+    ssLoad(bufferReader, obj, loadMode);
+}
+
+template<typename T>
+void ssLoadInPlace(BufferReader&& bufferReader, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    ssLoadInPlace(static_cast<BufferReader&>(bufferReader), obj, loadMode);
+}
+
+template<typename T>
+void ssLoadInPlace(const Buffer& buffer, T& obj, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    ssLoadInPlace(BufferReader(buffer), obj, loadMode);
+}
+
+// ------ Hoisted framing ------
+// Layout of non-empty containers of 'T' with 'SSHoistFraming<T>' (after items count):
+//   segments count, then per segment: version, size, payloads of all items in this version.
+// Segments are ordered and chosen the same way as for a single object (see 'ssLoadInternalInto').
+template<typename VersionsTuple, size_t... Is>
+constexpr bool ssCanHoistVersions(std::index_sequence<Is...>)
+{
+    return ((can_ssTuple<std::tuple_element_t<Is, VersionsTuple>>::value &&
+             !can_ssSaveImpl<std::tuple_element_t<Is, VersionsTuple>>::value &&
+             !Handlers<std::tuple_element_t<Is, VersionsTuple>>::value &&
+             !can_ssLoadImpl<std::tuple_element_t<Is, VersionsTuple>&, BufferReader&>::value &&
+             std::tuple_size_v<std::decay_t<decltype(std::declval<const std::tuple_element_t<Is, VersionsTuple>&>().ssTuple())>> > 0) && ...);
+}
+
+template<typename T>
+constexpr void ssCheckHoistable()
+{
+    using Versions = SSVersions_t<T>;
+    static_assert(ssCanHoistVersions<Versions>(std::make_index_sequence<std::tuple_size_v<Versions>>()),
+                  "SSHoistFraming: all versions of T must be serialized by non-empty 'ssTuple'");
+}
+
+// Passes items of each written version (newest first) to 'func', making the older ones by downgrade
+template<size_t Index, typename VersionsTuple, size_t Offset, typename Items, typename Func>
+void ssForHoistedColumns(const Items& items, Func& func, const SSSegmentPolicy& policy)
+{
+    func(std::integral_constant<size_t, Index>(), items);
+
+    if (!ssAllowsPrevSegment<Index, VersionsTuple, Offset>(policy))
+        return;
+
+    if constexpr (Index > 0) {
+        using PrevType = std::tuple_element_t<Index - 1, VersionsTuple>;
+        std::vector<PrevType> prevItems;
+
+        for (const auto& x : items) {
+            ssForPrevSegment<Index, VersionsTuple>(x, [&prevItems, &items](const PrevType& prevObj) {
+                if (prevItems.empty())
+                    prevItems.reserve(containerSize(items));
+                prevItems.push_back(prevObj);
+            });
+        }
+
+        if (!prevItems.empty()) // Empty if downgrade is deleted
+            ssForHoistedColumns<Index - 1, VersionsTuple, Offset>(prevItems, func, policy);
+    }
+}
+
+template<typename T, typename C>
+void ssSaveHoistedItems(BufferWriter& writer, const C& items)
+{
+    ssCheckHoistable<T>();
+
+    const auto countPos = writer.writePlaceholder<uint8_t>();
+    uint8_t segmentsWritten {};
+
+    auto saveColumn = [&writer, &segmentsWritten](auto index, const auto& columnItems) {
+        const auto segment = Internal::ssBeginSegment(writer, static_cast<uint8_t>(decltype(index)::value + SSVersionOffset<T>::value), [&columnItems](){
+            size_t result {};
+            for (const auto& x : columnItems)
+                result += ssSerializedSizeImplInternal(x);
+            return result;
+        });
+
+        for (const auto& x : columnItems) {
+            ssBeforeSaveImpl(x);
+            ssSaveImplInternal(writer, x);
+            ssAfterSaveImpl(x);
+        }
+
+        Internal::ssEndSegment(writer, segment);
+        segmentsWritten++;
+    };
+
+    ssForHoistedColumns<std::tuple_size_v<SSVersions_t<T>> - 1, SSVersions_t<T>, SSVersionOffset<T>::value>(items, saveColumn, ssSegmentPolicy<T>());
+    writer.patch(countPos, segmentsWritten);
+}
+
+template<typename T, typename C>
+size_t ssSerializedSizeHoistedItems(const C& items)
+{
+    ssCheckHoistable<T>();
+
+    size_t result = sizeof(uint8_t); // Segments count
+
+    auto sizeColumn = [&result](auto /*index*/, const auto& columnItems) {
+        const auto sizes = Internal::currentSegmentSizes();
+        const auto isRecording = sizes && sizes->isRecording();
+        const auto slot = isRecording ? sizes->reserve() : 0;
+
+        size_t columnSize {};
+        for (const auto& x : columnItems)
+            columnSize += ssSerializedSizeImplInternal(x);
+
+        if (isRecording)
+            sizes->set(slot, columnSize);
+
+        result += sizeof(uint8_t) + Internal::ssLengthSize(columnSize) + columnSize; // Version, size, payloads
+    };
+
+    ssForHoistedColumns<std::tuple_size_v<SSVersions_t<T>> - 1, SSVersions_t<T>, SSVersionOffset<T>::value>(items, sizeColumn, ssSegmentPolicy<T>());
+    return result;
+}
+
+// Picks the segment which would be loaded, skips others. Returns its data & stored version.
+template<typename T>
+std::pair<BufferReader, uint8_t> ssReadHoistedColumn(BufferReader& bufferReader, uint64_t count)
+{
+    ssCheckHoistable<T>();
+
+    const auto segmentsCount = bufferReader.read<uint8_t>();
+    std::optional<std::pair<BufferReader, uint8_t>> result;
+
+    for (uint8_t i = 0; i < segmentsCount; i++) {
+        const auto storedVersion = bufferReader.read<uint8_t>();
+        const auto segmentSize = Internal::ssReadLength(bufferReader);
+        auto segmentData = bufferReader.readRaw(segmentSize);
+
+        if (!result && storedVersion <= SSVersion<T>::value)
+            result.emplace(segmentData, storedVersion);
+    }
+
+    if (!result || result->second < SSVersionOffset<T>::value)
+        Internal::throwVersionError();
+
+    // Payload of non-empty 'ssTuple' takes at least one byte, so corrupted count fails here
+    if (count > result->first.rest())
+        Internal::throwOutOfRange();
+
+    return *result;
+}
+
+template<size_t I, typename T, typename Emit>
+void ssLoadHoistedColumn(BufferReader& column, uint64_t count, size_t tuplePos, Emit& emit)
+{
+    using Versions = SSVersions_t<T>;
+    constexpr auto lastTuplePos = std::tuple_size_v<Versions> - 1;
+
+    if constexpr (I <= lastTuplePos) {
+        if (I != tuplePos) {
+            ssLoadHoistedColumn<I + 1, T>(column, count, tuplePos, emit);
+            return;
+        }
+
+        for (uint64_t i = 0; i < count; i++) {
+            auto obj = construct<T>();
+            ssBeforeLoadImpl(obj);
+
+            if constexpr (I == lastTuplePos) {
+                ssLoadImplInternal(column, obj);
+            } else {
+                auto storedObj = construct<std::tuple_element_t<I, Versions>>();
+                ssLoadImplInternal(column, storedObj);
+                ssLoadAndConvertIter2<I>(obj, std::move(storedObj));
+            }
+
+            ssAfterLoadImpl(obj);
+            emit(std::move(obj));
+        }
+    } else {
+        Internal::throwVersionError();
+    }
+}
+
+// Loads 'count' items, passing each to 'emit'. Upgrade path is resolved once for all items.
+template<typename T, typename Emit>
+void ssLoadHoistedItems(BufferReader& bufferReader, uint64_t count, Emit&& emit)
+{
+    auto [column, storedVersion] = ssReadHoistedColumn<T>(bufferReader, count);
+    ssLoadHoistedColumn<0, T>(column, count, storedVersion - SSVersionOffset<T>::value, emit);
+
+    if (column.rest() != 0)
+        Internal::throwFormat();
+}
+
+template<typename T>
+void ssValidateHoistedItems(BufferReader& bufferReader, uint64_t count)
+{
+    auto [column, storedVersion] = ssReadHoistedColumn<T>(bufferReader, count);
+
+    for (uint64_t i = 0; i < count; i++)
+        ssValidateVersionSegment<SSVersions_t<T>, SSVersionOffset<T>::value>(column, storedVersion);
+
+    if (column.rest() != 0)
+        Internal::throwFormat();
+}
+// ------ ------
+
 } // namespace SuitableStruct
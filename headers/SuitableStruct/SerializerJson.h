@@ -258,54 +258,29 @@ void ssJsonLoadImpl(const QJsonValue& value, T& obj)
 // Conversion helpers for versioning
 template<size_t I, typename TargetAppType, typename LoadedSegmentType,
          typename std::enable_if<!(I <= std::tuple_size_v<SSVersions_t<TargetAppType>> - 1)>::type* = nullptr> // I is out of bounds for iteration
-void ssJsonLoadAndConvertIter2(TargetAppType&, const LoadedSegmentType&)
+void ssJsonLoadAndConvertIter2(TargetAppType&, LoadedSegmentType&&)
 {
     Internal::throwVersionError();
 }
 
 template<size_t I, typename TargetAppType, typename LoadedSegmentType,
          typename std::enable_if<I == std::tuple_size_v<SSVersions_t<TargetAppType>> - 1>::type* = nullptr> // I is last tuple position (current version)
-void ssJsonLoadAndConvertIter2(TargetAppType& obj, const LoadedSegmentType& srcObj)
+void ssJsonLoadAndConvertIter2(TargetAppType& obj, LoadedSegmentType&& srcObj)
 {
     // Final conversion: srcObj (previous version type) → obj (TargetAppType)
-    if constexpr (std::is_same_v<TargetAppType, LoadedSegmentType>) {
-        obj = srcObj;
-    } else if constexpr (HasSSUpgradeFromInType<TargetAppType, const LoadedSegmentType&>::value) {
-        obj.ssUpgradeFrom(srcObj);
-    } else if constexpr (HasSSUpgradeFromInHandlers<TargetAppType, const LoadedSegmentType&>::value) {
-        Handlers<TargetAppType>::ssUpgradeFrom(srcObj, obj);
-    } else if constexpr (std::is_convertible_v<LoadedSegmentType, TargetAppType>) {
-        obj = static_cast<TargetAppType>(srcObj);
-    } else {
-        static_assert(HasSSUpgradeFromInType<TargetAppType, const LoadedSegmentType&>::value ||
-                          HasSSUpgradeFromInHandlers<TargetAppType, const LoadedSegmentType&>::value ||
-                          std::is_convertible_v<LoadedSegmentType, TargetAppType>,
-                      "ssUpgradeFrom() or convertible missing for final JSON up-conversion step to TargetAppType");
-    }
+    ssUpgradeStep(obj, std::forward<LoadedSegmentType>(srcObj));
 }
 
 // Iterate I from (tuplePos of loaded data + 1) up to last tuple position.
 // At each step, convert from std::tuple_element_t<I-1, Versions> to std::tuple_element_t<I, Versions>
 template<size_t I, typename TargetAppType, typename PreviousVersionType, /* PreviousVersionType is type of version I-1 */
          typename std::enable_if< (I < std::tuple_size_v<SSVersions_t<TargetAppType>> - 1) && (I < std::tuple_size_v<SSVersions_t<TargetAppType>>) >::type* = nullptr>
-void ssJsonLoadAndConvertIter2(TargetAppType& finalObj, const PreviousVersionType& prevVersionObj)
+void ssJsonLoadAndConvertIter2(TargetAppType& finalObj, PreviousVersionType&& prevVersionObj)
 {
     using CurrentIterTargetType = std::tuple_element_t<I, SSVersions_t<TargetAppType>>;
-    auto currentIterObj = construct_unique<CurrentIterTargetType>();
-
-    if constexpr (HasSSUpgradeFromInType<CurrentIterTargetType, const PreviousVersionType&>::value) {
-        currentIterObj->ssUpgradeFrom(prevVersionObj);
-    } else if constexpr (HasSSUpgradeFromInHandlers<CurrentIterTargetType, const PreviousVersionType&>::value) {
-        Handlers<CurrentIterTargetType>::ssUpgradeFrom(prevVersionObj, *currentIterObj);
-    } else if constexpr (std::is_convertible_v<PreviousVersionType, CurrentIterTargetType>) {
-        *currentIterObj = static_cast<CurrentIterTargetType>(prevVersionObj);
-    } else {
-        static_assert(HasSSUpgradeFromInType<CurrentIterTargetType, const PreviousVersionType&>::value ||
-                          HasSSUpgradeFromInHandlers<CurrentIterTargetType, const PreviousVersionType&>::value ||
-                          std::is_convertible_v<PreviousVersionType, CurrentIterTargetType>,
-                      "ssUpgradeFrom() or convertible missing for intermediate JSON up-conversion step");
-    }
-    ssJsonLoadAndConvertIter2<I+1>(finalObj, *currentIterObj); // Convert from current (I) to next (I+1)
+    auto currentIterObj = construct<CurrentIterTargetType>();
+    ssUpgradeStep(currentIterObj, std::forward<PreviousVersionType>(prevVersionObj));
+    ssJsonLoadAndConvertIter2<I+1>(finalObj, std::move(currentIterObj)); // Convert from current (I) to next (I+1)
 }
 
 template<size_t I, typename TargetAppType,
@@ -332,13 +307,13 @@ void ssJsonLoadAndConvertIter(const QJsonValue& rawDataForSerializedVer, TargetA
         ssJsonLoadAndConvertIter<I+1>(rawDataForSerializedVer, objToPopulate, serializedTuplePos);
     } else if (I == serializedTuplePos) {
         using TypeOfSerializedData = std::tuple_element_t<I, SSVersions_t<TargetAppType>>;
-        auto loadedSerializedVerObject = construct_unique<TypeOfSerializedData>();
-        ssJsonLoadImpl(rawDataForSerializedVer, *loadedSerializedVerObject);
+        auto loadedSerializedVerObject = construct<TypeOfSerializedData>();
+        ssJsonLoadImpl(rawDataForSerializedVer, loadedSerializedVerObject);
 
         if constexpr (I == lastTuplePos) {
-            objToPopulate = std::move(*loadedSerializedVerObject);
+            objToPopulate = std::move(loadedSerializedVerObject);
         } else {
-            ssJsonLoadAndConvertIter2<I + 1>(objToPopulate, *loadedSerializedVerObject);
+            ssJsonLoadAndConvertIter2<I + 1>(objToPopulate, std::move(loadedSerializedVerObject));
         }
     } else {
         Internal::throwVersionError();
@@ -387,7 +362,8 @@ void ssJsonLoad(const QJsonValue& value, T& obj, SSLoadMode loadMode /*= SSLoadM
 {
     auto temp = construct_unique<T>();
 
-    if (loadMode == SSLoadMode::Protected) {
+    if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+        const bool verifyHash = (loadMode == SSLoadMode::Protected);
         if (!value.isObject()) Internal::throwFormat();
         const auto rootObject = value.toObject();
 
@@ -407,7 +383,7 @@ void ssJsonLoad(const QJsonValue& value, T& obj, SSLoadMode loadMode /*= SSLoadM
             uint32_t expectedHash;
             ssJsonLoadImpl(rootObject[Internal::KEY_HASH], expectedHash); // Hash is a uint saved as JSON
 
-            if (expectedHash != Internal::ssJsonHashValue(segmentsValue)) {
+            if (verifyHash && expectedHash != Internal::ssJsonHashValue(segmentsValue)) {
                 Internal::throwIntegrity();
             }
             ssJsonLoadInternal(segmentsValue, *temp); // This calls before/after hooks internally
@@ -418,7 +394,7 @@ void ssJsonLoad(const QJsonValue& value, T& obj, SSLoadMode loadMode /*= SSLoadM
             uint32_t expectedHash;
             ssJsonLoadImpl(rootObject[Internal::KEY_HASH], expectedHash);
 
-            if (expectedHash != Internal::ssJsonHashValue_F0(legacyContent)) {
+            if (verifyHash && expectedHash != Internal::ssJsonHashValue_F0(legacyContent)) {
                 Internal::throwIntegrity();
             }
 
@@ -437,6 +413,7 @@ void ssJsonLoad(const QJsonValue& value, T& obj, SSLoadMode loadMode /*= SSLoadM
                 case SSLoadMode::NonProtectedF1Hint:  return true;
                 case SSLoadMode::NonProtectedDefault: return !isProcessingLegacyFormatOpt(Internal::FormatType::Json).value_or(false);
                 case SSLoadMode::Protected:
+                case SSLoadMode::ProtectedTrusted:
                     assert(false && "Should never reach here");
                     return false;
             }
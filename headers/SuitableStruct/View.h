@@ -0,0 +1,167 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <SuitableStruct/Serializer.h>
+
+namespace SuitableStruct {
+
+template<typename T> class SSView;
+
+namespace Internal {
+
+template<typename T, size_t I>
+using SSViewMember_t = std::decay_t<std::tuple_element_t<I, std::decay_t<decltype(std::declval<const T&>().ssTuple())>>>;
+
+template<typename T, size_t I = 0>
+void ssSkipMembers(BufferReader& bufferReader, size_t count)
+{
+    if constexpr (I < std::tuple_size_v<std::decay_t<decltype(std::declval<const T&>().ssTuple())>>) {
+        if (I == count)
+            return;
+
+        ssSkipInternal<SSViewMember_t<T, I>>(bufferReader);
+        ssSkipMembers<T, I + 1>(bufferReader, count);
+    }
+}
+
+} // namespace Internal
+
+// Read-only accessor to serialized 'ssTuple' struct (format F1...F4).
+// Members are decoded on demand; preceding members are skipped by segment framing, without decoding.
+// Only the segment of 'T's own version is used: views don't upgrade older data.
+// Make sure lifetime of source memory is greater than 'SSView's.
+template<typename T>
+class SSView
+{
+    static_assert(can_ssTuple<T>::value && !can_ssSaveImpl<T>::value && !Handlers<T>::value,
+                  "SSView supports only types serialized by 'ssTuple'");
+
+public:
+    using Type = T;
+    static constexpr size_t MembersCount = std::tuple_size_v<std::decay_t<decltype(std::declval<const T&>().ssTuple())>>;
+
+    // Data as produced by 'ssSave(obj, protectedMode)'. F0 data isn't supported.
+    // Non-protected data is read in the format of current scope
+    // (see 'Internal::CompactFormatScope' and 'Internal::IndexedFormatScope').
+    explicit SSView(BufferReader bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+        : m_segment(bufferReader),
+          m_isCompact(Internal::isCompactFormat()),
+          m_isIndexed(Internal::isIndexedFormat())
+    {
+        if (loadMode == SSLoadMode::Protected || loadMode == SSLoadMode::ProtectedTrusted) {
+            const auto envelopeStart = bufferReader.position();
+            const auto info = Internal::readEnvelope(bufferReader, loadMode == SSLoadMode::Protected);
+
+            if (info.format == SSDataFormat::F0)
+                Internal::throwFormat();
+
+            m_isCompact = (info.format == SSDataFormat::F3);
+            m_isIndexed = (info.format == SSDataFormat::F4);
+            BufferReader envelopeReader(bufferReader);
+            envelopeReader.seek(envelopeStart + info.payloadOffset);
+            init(envelopeReader.readRaw(info.payloadSize));
+        } else {
+            if (loadMode == SSLoadMode::NonProtectedF0Hint)
+                Internal::throwFormat();
+
+            init(bufferReader);
+        }
+    }
+
+    // Decodes member 'I' of 'T::ssTuple()'
+    template<size_t I>
+    [[nodiscard]] Internal::SSViewMember_t<T, I> get() const
+    {
+        static_assert(I < MembersCount, "Member index is out of bounds");
+
+        Internal::CompactFormatScope compactScope(m_isCompact);
+        Internal::IndexedFormatScope indexedScope(m_isIndexed);
+        auto reader = memberReader(I);
+        auto result = construct<Internal::SSViewMember_t<T, I>>();
+        Internal::LegacyFormatScope legacyScope(Internal::FormatType::Binary, false);
+        ssLoadInternal(reader, result);
+        return result;
+    }
+
+    // View of nested struct member 'I'
+    template<size_t I>
+    [[nodiscard]] SSView<Internal::SSViewMember_t<T, I>> field() const
+    {
+        static_assert(I < MembersCount, "Member index is out of bounds");
+        Internal::CompactFormatScope compactScope(m_isCompact);
+        Internal::IndexedFormatScope indexedScope(m_isIndexed);
+        return SSView<Internal::SSViewMember_t<T, I>>(memberReader(I), SSLoadMode::NonProtectedF1Hint);
+    }
+
+    // Decodes whole object
+    [[nodiscard]] T load() const
+    {
+        auto result = construct<T>();
+        auto reader = m_segment;
+        Internal::CompactFormatScope compactScope(m_isCompact);
+        Internal::IndexedFormatScope indexedScope(m_isIndexed);
+        Internal::LegacyFormatScope legacyScope(Internal::FormatType::Binary, false);
+        ssBeforeLoadImpl(result);
+        ssLoadImplInternal(reader, result);
+        ssAfterLoadImpl(result);
+        return result;
+    }
+
+private:
+    void init(BufferReader objectReader)
+    {
+        if constexpr (ssIsFrameless<T>()) {
+            // Members follow right away; the view may extend past the object, members are skipped by their own size
+            m_segment = objectReader;
+            return;
+        }
+
+        Internal::CompactFormatScope compactScope(m_isCompact);
+        const auto segmentsCount = objectReader.read<uint8_t>();
+
+        for (uint8_t i = 0; i < segmentsCount; i++) {
+            const auto storedVersion = objectReader.read<uint8_t>();
+            const auto segmentSize = Internal::ssReadLength(objectReader);
+            auto segmentData = objectReader.readRaw(segmentSize);
+
+            if (storedVersion == SSVersion<T>::value) {
+                m_segment = segmentData;
+                return;
+            }
+        }
+
+        Internal::throwVersionError();
+    }
+
+    BufferReader memberReader(size_t index) const
+    {
+        auto reader = m_segment;
+        Internal::ssSkipMembers<T>(reader, index);
+        return reader;
+    }
+
+private:
+    BufferReader m_segment;
+    bool m_isCompact {};
+    bool m_isIndexed {};
+};
+
+template<typename T>
+[[nodiscard]] SSView<T> ssView(BufferReader& bufferReader, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    return SSView<T>(bufferReader, loadMode);
+}
+
+template<typename T>
+[[nodiscard]] SSView<T> ssView(const Buffer& buffer, SSLoadMode loadMode = SSLoadMode::Protected)
+{
+    return SSView<T>(BufferReader(buffer), loadMode);
+}
+
+} // namespace SuitableStruct
@@ -42,7 +42,7 @@ void Buffer::write(const Buffer& buffer)
 
 void Buffer::write(Buffer&& buffer)
 {
-    if (size()) {
+    if (size() || memoryResource() != buffer.memoryResource()) {
         writeRaw(buffer.cdata(), buffer.size());
     } else {
         m_sso = std::move(buffer.m_sso);
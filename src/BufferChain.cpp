@@ -0,0 +1,121 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <SuitableStruct/BufferChain.h>
+#include <SuitableStruct/Hashes.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace SuitableStruct {
+
+namespace {
+
+// Calls 'func' for pieces of equal size from both chains, until it returns false
+template<typename Func>
+bool forEachPair(const std::vector<BufferChain::Chunk>& lhs, const std::vector<BufferChain::Chunk>& rhs, Func&& func)
+{
+    size_t lhsIdx = 0, lhsPos = 0;
+    size_t rhsIdx = 0, rhsPos = 0;
+
+    while (lhsIdx < lhs.size() && rhsIdx < rhs.size()) {
+        const auto& l = lhs[lhsIdx];
+        const auto& r = rhs[rhsIdx];
+        const auto sz = std::min(l.size - lhsPos, r.size - rhsPos);
+
+        if (!func(l.data + lhsPos, r.data + rhsPos, sz))
+            return false;
+
+        lhsPos += sz;
+        rhsPos += sz;
+        if (lhsPos == l.size) { lhsIdx++; lhsPos = 0; }
+        if (rhsPos == r.size) { rhsIdx++; rhsPos = 0; }
+    }
+
+    return true;
+}
+
+bool equalBytes(const uint8_t* lhs, const uint8_t* rhs, size_t sz)
+{
+    return memcmp(lhs, rhs, sz) == 0;
+}
+
+} // namespace
+
+bool BufferChain::operator==(const BufferChain& rhs) const
+{
+    if (this == &rhs) return true;
+    if (size() != rhs.size()) return false;
+    return forEachPair(m_chunks, rhs.m_chunks, equalBytes);
+}
+
+bool BufferChain::operator==(const Buffer& rhs) const
+{
+    if (size() != rhs.size()) return false;
+    return forEachPair(m_chunks, {Chunk{rhs.cdata(), rhs.size(), {}}}, equalBytes);
+}
+
+void BufferChain::append(Buffer&& buffer)
+{
+    if (!buffer.size()) return;
+    auto storage = std::make_shared<const Buffer>(std::move(buffer));
+    appendShared(storage->cdata(), storage->size(), storage);
+}
+
+void BufferChain::append(const BufferChain& chain)
+{
+    m_chunks.insert(m_chunks.end(), chain.m_chunks.begin(), chain.m_chunks.end());
+    m_size += chain.m_size;
+}
+
+void BufferChain::appendShared(const uint8_t* data, size_t size, std::shared_ptr<const void> owner)
+{
+    if (!size) return;
+    m_chunks.push_back({data, size, std::move(owner)});
+    m_size += size;
+}
+
+void BufferChain::appendShared(std::shared_ptr<const Buffer> buffer)
+{
+    if (!buffer) return;
+    const auto data = buffer->cdata();
+    const auto size = buffer->size();
+    appendShared(data, size, std::move(buffer));
+}
+
+void BufferChain::clear()
+{
+    m_chunks.clear();
+    m_size = 0;
+}
+
+uint32_t BufferChain::hash() const
+{
+    auto result = ssHashRaw_F1(nullptr, 0);
+    for (const auto& x : m_chunks)
+        result = ssHashRawContinue_F1(result, x.data, x.size);
+    return result;
+}
+
+Buffer BufferChain::toBuffer() const
+{
+    Buffer result;
+    result.reserve(m_size);
+    for (const auto& x : m_chunks)
+        result.writeRaw(x.data, x.size);
+    return result;
+}
+
+#ifdef SUITABLE_STRUCT_HAS_IOVEC
+std::vector<iovec> BufferChain::iovecs() const
+{
+    std::vector<iovec> result;
+    result.reserve(m_chunks.size());
+    for (const auto& x : m_chunks)
+        result.push_back({const_cast<uint8_t*>(x.data), x.size});
+    return result;
+}
+#endif // SUITABLE_STRUCT_HAS_IOVEC
+
+} // namespace SuitableStruct
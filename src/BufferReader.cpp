@@ -14,6 +14,32 @@ uint32_t BufferReader::hash() const
     return ssHashRaw(data(), rest());
 }
 
+uint64_t BufferReader::readVarintSlow()
+{
+    const auto available = rest();
+    const auto src = data();
+    uint64_t result = 0;
+
+    // Up to 10 bytes, the last one may hold only the highest bit
+    for (size_t i = 0; i < 10; i++) {
+        if (i == available)
+            Internal::throwOutOfRange();
+
+        const uint64_t byte = src[i];
+        result |= (byte & 0x7F) << (7 * i);
+
+        if (byte < 0x80) {
+            if (i == 9 && byte > 1)
+                Internal::throwFormat();
+
+            m_position += i + 1;
+            return result;
+        }
+    }
+
+    Internal::throwFormat();
+}
+
 void BufferReader::checkPosition(size_t pos) const
 {
     if (pos > size())
@@ -0,0 +1,111 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <SuitableStruct/BufferWriter.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Hashes.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace SuitableStruct {
+
+uint32_t BufferWriter::hash(size_t pos, size_t sz) const
+{
+    auto result = ssHashRaw(nullptr, 0);
+    forEachPart(pos, sz, [&result](const uint8_t* data, size_t size) {
+        result = ssHashRawContinue_F1(result, data, size);
+    });
+    return result;
+}
+
+BufferChain BufferWriter::takeChain()
+{
+    auto storage = std::make_shared<const Buffer>(std::move(m_buffer));
+    m_buffer = Buffer();
+
+    BufferChain result;
+    size_t bufferPos = 0;
+
+    for (auto& x : m_shared) {
+        const auto partBufferPos = m_offsetStart + x.position - x.sharedBefore;
+        result.appendShared(storage->cdata() + bufferPos, partBufferPos - bufferPos, storage);
+        result.appendShared(x.chunk.data, x.chunk.size, std::move(x.chunk.owner));
+        bufferPos = partBufferPos;
+    }
+
+    result.appendShared(storage->cdata() + bufferPos, storage->size() - bufferPos, storage);
+
+    m_shared.clear();
+    m_sharedSize = 0;
+    m_offsetStart = 0;
+    return result;
+}
+
+size_t BufferWriter::bufferPositionChained(size_t pos, size_t sz) const
+{
+    checkRange(pos, sz);
+
+    // Last referenced part starting at or before 'pos'
+    auto it = std::upper_bound(m_shared.cbegin(), m_shared.cend(), pos,
+                               [](size_t value, const SharedPart& part) { return value < part.position; });
+
+    size_t sharedBefore = 0;
+    if (it != m_shared.cbegin()) {
+        const auto& prev = *std::prev(it);
+        if (pos < prev.position + prev.chunk.size)
+            Internal::throwOutOfRange();
+        sharedBefore = prev.sharedBefore + prev.chunk.size;
+    }
+
+    if (it != m_shared.cend() && pos + sz > it->position)
+        Internal::throwOutOfRange();
+
+    return m_offsetStart + pos - sharedBefore;
+}
+
+void BufferWriter::forEachPartChained(size_t pos, size_t sz, const std::function<void(const uint8_t*, size_t)>& func) const
+{
+    const auto end = pos + sz;
+    size_t sharedBefore = 0;
+
+    for (const auto& x : m_shared) {
+        if (pos == end)
+            return;
+
+        const auto partEnd = x.position + x.chunk.size;
+
+        if (pos < x.position) {
+            const auto inlineEnd = std::min(end, x.position);
+            func(m_buffer.cdata() + m_offsetStart + pos - sharedBefore, inlineEnd - pos);
+            pos = inlineEnd;
+        }
+
+        if (pos < end && pos < partEnd) {
+            const auto sharedEnd = std::min(end, partEnd);
+            func(x.chunk.data + (pos - x.position), sharedEnd - pos);
+            pos = sharedEnd;
+        }
+
+        sharedBefore += x.chunk.size;
+    }
+
+    if (pos < end)
+        func(m_buffer.cdata() + m_offsetStart + pos - sharedBefore, end - pos);
+}
+
+void BufferWriter::appendShared(const uint8_t* data, size_t sz, const std::shared_ptr<const void>& owner)
+{
+    m_shared.push_back({position(), m_sharedSize, {data, sz, owner}});
+    m_sharedSize += sz;
+}
+
+void BufferWriter::checkRange(size_t pos, size_t sz) const
+{
+    // Check for overflow when adding size to position
+    if (pos > position() || sz > position() - pos)
+        Internal::throwOutOfRange();
+}
+
+} // namespace SuitableStruct
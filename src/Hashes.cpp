@@ -4,8 +4,21 @@
 
 #include <SuitableStruct/Hashes.h>
 
+#include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SUITABLE_STRUCT_CRC32C_X86
+#include <nmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define SUITABLE_STRUCT_CRC32C_ARM
+#include <arm_acle.h>
+#endif
 
 namespace SuitableStruct {
 
@@ -43,10 +56,14 @@ uint32_t ssHashRaw_F0(const void* ptr, size_t sz) // Legacy format F0
 uint32_t ssHashRaw_F1(const void* ptr, size_t sz)
 {
     constexpr uint32_t fnvOffsetBasis = 2166136261u;
+    return ssHashRawContinue_F1(fnvOffsetBasis, ptr, sz);
+}
+
+uint32_t ssHashRawContinue_F1(uint32_t hash, const void* ptr, size_t sz)
+{
     constexpr uint32_t fnvPrime = 16777619u;
 
     const auto* data = static_cast<const uint8_t*>(ptr);
-    uint32_t hash = fnvOffsetBasis;
 
     for (size_t i = 0; i < sz; ++i) {
         hash ^= data[i];
@@ -56,6 +73,136 @@ uint32_t ssHashRaw_F1(const void* ptr, size_t sz)
     return hash;
 }
 
+namespace {
+
+// CRC32C (Castagnoli), reflected polynomial
+constexpr uint32_t Crc32cPoly = 0x82F63B78u;
+
+// Slicing-by-8 tables for the portable implementation
+constexpr std::array<std::array<uint32_t, 256>, 8> makeCrc32cTables()
+{
+    std::array<std::array<uint32_t, 256>, 8> tables {};
+
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (Crc32cPoly & (0u - (crc & 1u)));
+        tables[0][i] = crc;
+    }
+
+    for (size_t t = 1; t < tables.size(); t++)
+        for (size_t i = 0; i < 256; i++)
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+
+    return tables;
+}
+
+constexpr auto Crc32cTables = makeCrc32cTables();
+
+uint32_t crc32cPortable(uint32_t crc, const uint8_t* data, size_t sz)
+{
+    while (sz >= 8) {
+        uint32_t low;
+        uint32_t high;
+        memcpy(&low, data, sizeof(low));
+        memcpy(&high, data + 4, sizeof(high));
+        low ^= crc;
+
+        crc = Crc32cTables[7][low & 0xFF] ^
+              Crc32cTables[6][(low >> 8) & 0xFF] ^
+              Crc32cTables[5][(low >> 16) & 0xFF] ^
+              Crc32cTables[4][low >> 24] ^
+              Crc32cTables[3][high & 0xFF] ^
+              Crc32cTables[2][(high >> 8) & 0xFF] ^
+              Crc32cTables[1][(high >> 16) & 0xFF] ^
+              Crc32cTables[0][high >> 24];
+
+        data += 8;
+        sz -= 8;
+    }
+
+    while (sz--)
+        crc = (crc >> 8) ^ Crc32cTables[0][(crc ^ *data++) & 0xFF];
+
+    return crc;
+}
+
+#ifdef SUITABLE_STRUCT_CRC32C_X86
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif
+uint32_t crc32cHardware(uint32_t crc, const uint8_t* data, size_t sz)
+{
+    uint64_t crc64 = crc;
+
+    while (sz >= 8) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        crc64 = _mm_crc32_u64(crc64, value);
+        data += 8;
+        sz -= 8;
+    }
+
+    auto crc32 = static_cast<uint32_t>(crc64);
+    while (sz--)
+        crc32 = _mm_crc32_u8(crc32, *data++);
+
+    return crc32;
+}
+
+bool hasHardwareCrc32c()
+{
+#ifdef _MSC_VER
+    int cpuInfo[4] {};
+    __cpuid(cpuInfo, 1);
+    return (cpuInfo[2] & (1 << 20)) != 0; // SSE4.2
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+#elif defined(SUITABLE_STRUCT_CRC32C_ARM)
+uint32_t crc32cHardware(uint32_t crc, const uint8_t* data, size_t sz)
+{
+    while (sz >= 8) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        crc = __crc32cd(crc, value);
+        data += 8;
+        sz -= 8;
+    }
+
+    while (sz--)
+        crc = __crc32cb(crc, *data++);
+
+    return crc;
+}
+
+constexpr bool hasHardwareCrc32c() { return true; } // Checked at compile time by __ARM_FEATURE_CRC32
+#endif
+
+} // namespace
+
+// CRC32C hash (F2)
+uint32_t ssHashRaw_F2(const void* ptr, size_t sz)
+{
+    return ssHashRawContinue_F2(0, ptr, sz);
+}
+
+uint32_t ssHashRawContinue_F2(uint32_t hash, const void* ptr, size_t sz)
+{
+    const auto* data = static_cast<const uint8_t*>(ptr);
+    uint32_t crc = ~hash;
+
+#if defined(SUITABLE_STRUCT_CRC32C_X86) || defined(SUITABLE_STRUCT_CRC32C_ARM)
+    static const bool hardware = hasHardwareCrc32c();
+    crc = hardware ? crc32cHardware(crc, data, sz) : crc32cPortable(crc, data, sz);
+#else
+    crc = crc32cPortable(crc, data, sz);
+#endif
+
+    return ~crc;
+}
+
 uint32_t ssHashRaw(const void *ptr, size_t sz)
 {
     return ssHashRaw_F1(ptr, sz);
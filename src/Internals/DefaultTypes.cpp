@@ -45,47 +45,189 @@ QString getTimepoint_Marker_v2_String()
 #endif // SUITABLE_STRUCT_HAS_QT_LIBRARY
 } // namespace Helpers
 
+namespace Internal {
+
+ItemsIndex ssReadItemsIndex(BufferReader& bufferReader, uint64_t count)
+{
+    ItemsIndex result;
+    result.grain = bufferReader.readVarint();
+
+    if (!result.grain)
+        return result;
+
+    const auto chunksCount = count / result.grain + (count % result.grain ? 1 : 0);
+
+    if (chunksCount > bufferReader.rest() / sizeof(uint64_t))
+        throwOutOfRange();
+
+    result.chunkEnds.resize(static_cast<size_t>(chunksCount));
+    bufferReader.readRaw(result.chunkEnds.data(), result.chunkEnds.size() * sizeof(uint64_t));
+
+    if (!std::is_sorted(result.chunkEnds.cbegin(), result.chunkEnds.cend()))
+        throwFormat();
+
+    if (result.itemsSize() > bufferReader.rest())
+        throwOutOfRange();
+
+    return result;
+}
+
+} // namespace Internal
+
+void ssSaveImplTo(BufferWriter& writer, const std::string& value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+    Internal::ssWriteBytesOf(writer, &value, value.data(), value.size());
+}
+
 Buffer ssSaveImpl(const std::string& value)
 {
-    Buffer buffer;
-    buffer.write((uint64_t)value.size());
-    buffer.writeRaw(value.data(), value.size());
-    return buffer;
+    return ssSaveImplViaWriter(value);
+}
+
+size_t ssSerializedSizeImpl(const std::string& value)
+{
+    return Internal::ssLengthSize(value.size()) + value.size();
 }
 
 void ssLoadImpl(BufferReader& bufferReader, std::string& value)
 {
     // Load & swap is not needed here because it's implemented in ssLoad
 
-    uint64_t sz;
-    bufferReader.read(sz);
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (sz > bufferReader.rest())
+        Internal::throwOutOfRange();
 
     value.resize(sz);
     bufferReader.readRaw(value.data(), sz);
 }
 
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::string>)
+{
+    Internal::ssValidateBytes(bufferReader);
+}
+
+void ssSaveImplTo(BufferWriter& writer, std::string_view value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+    writer.writeRaw(value.data(), value.size());
+}
+
+Buffer ssSaveImpl(std::string_view value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+size_t ssSerializedSizeImpl(std::string_view value)
+{
+    return Internal::ssLengthSize(value.size()) + value.size();
+}
+
+void ssLoadImpl(BufferReader& bufferReader, std::string_view& value)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (sz > bufferReader.rest())
+        Internal::throwOutOfRange();
+
+    value = std::string_view(reinterpret_cast<const char*>(bufferReader.data()), static_cast<size_t>(sz));
+    bufferReader.advance(static_cast<std::ptrdiff_t>(sz));
+}
+
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::string_view>)
+{
+    Internal::ssValidateBytes(bufferReader);
+}
+
+void ssSaveImplTo(BufferWriter& writer, const std::pmr::string& value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+    Internal::ssWriteBytesOf(writer, &value, value.data(), value.size());
+}
+
+Buffer ssSaveImpl(const std::pmr::string& value)
+{
+    return ssSaveImplViaWriter(value);
+}
+
+size_t ssSerializedSizeImpl(const std::pmr::string& value)
+{
+    return Internal::ssLengthSize(value.size()) + value.size();
+}
+
+void ssLoadImpl(BufferReader& bufferReader, std::pmr::string& value)
+{
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (sz > bufferReader.rest())
+        Internal::throwOutOfRange();
+
+    value.resize(sz);
+    bufferReader.readRaw(value.data(), sz);
+}
+
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<std::pmr::string>)
+{
+    Internal::ssValidateBytes(bufferReader);
+}
+
 
 #ifdef SUITABLE_STRUCT_HAS_QT_LIBRARY
 
+void ssSaveImplTo(BufferWriter& writer, const QByteArray& value)
+{
+    Internal::ssWriteLength(writer, static_cast<uint64_t>(value.size()));
+
+    if (writer.isChained() && static_cast<size_t>(value.size()) >= writer.sharedThreshold()) {
+        // Implicitly shared: the copy keeps the data alive without copying it
+        const auto owner = std::make_shared<const QByteArray>(value);
+        writer.writeShared(owner->constData(), static_cast<size_t>(owner->size()), owner);
+        return;
+    }
+
+    writer.writeRaw(value.constData(), value.size());
+}
+
 Buffer ssSaveImpl(const QByteArray& value)
 {
-    Buffer result;
-    result.write((uint64_t)value.size());
-    result.writeRaw(value.constData(), value.size());
-    return result;
+    return ssSaveImplViaWriter(value);
+}
+
+size_t ssSerializedSizeImpl(const QByteArray& value)
+{
+    return Internal::ssLengthSize(static_cast<uint64_t>(value.size())) + static_cast<size_t>(value.size());
 }
 
 void ssLoadImpl(BufferReader& bufferReader, QByteArray& value)
 {
-    uint64_t sz;
-    bufferReader.read(sz);
+    const auto sz = Internal::ssReadLength(bufferReader);
+
+    if (sz > bufferReader.rest())
+        Internal::throwOutOfRange();
+
     value.resize(sz);
     bufferReader.readRaw(value.data(), sz);
 }
 
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QByteArray>)
+{
+    Internal::ssValidateBytes(bufferReader);
+}
+
+void ssSaveImplTo(BufferWriter& writer, const QString& value)
+{
+    ssSaveImplTo(writer, value.toUtf8());
+}
+
 Buffer ssSaveImpl(const QString& value)
 {
-    return ssSaveImpl(value.toUtf8());
+    return ssSaveImplViaWriter(value);
+}
+
+size_t ssSerializedSizeImpl(const QString& value)
+{
+    return ssSerializedSizeImpl(value.toUtf8());
 }
 
 void ssLoadImpl(BufferReader& bufferReader, QString& value)
@@ -93,6 +235,11 @@ void ssLoadImpl(BufferReader& bufferReader, QString& value)
     value = QString::fromUtf8(ssLoadImplRet<QByteArray>(bufferReader));
 }
 
+void ssValidateImpl(BufferReader& bufferReader, SSTypeTag<QString>)
+{
+    Internal::ssValidateBytes(bufferReader);
+}
+
 Buffer ssSaveImpl(const QPoint& value)
 {
     Buffer result;
@@ -4,7 +4,17 @@
 
 #include <SuitableStruct/Internals/Helpers.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 namespace SuitableStruct {
 namespace Internal {
@@ -12,6 +22,15 @@ namespace Internal {
 // Private thread-local flags to track legacy format states
 static thread_local std::optional<bool> OptIsProcessingLegacyBinFormat;
 static thread_local std::optional<bool> OptIsProcessingLegacyJsonFormat;
+static thread_local bool IsLoadingInPlace = false;
+static thread_local bool IsCompactFormat = false;
+static thread_local bool IsIndexedFormat = false;
+static thread_local SSSegmentPolicy CurrentSegmentPolicy;
+static thread_local const std::shared_ptr<const void>* CurrentSharedPayloadOwner = nullptr;
+static thread_local std::pmr::memory_resource* CurrentMemoryResource = nullptr;
+static thread_local std::optional<SSParallelSave> CurrentParallelSave;
+static thread_local std::optional<SSParallelLoad> CurrentParallelLoad;
+static thread_local SegmentSizes* CurrentSegmentSizes = nullptr;
 
 std::optional<bool> isProcessingLegacyFormatOpt(FormatType formatType)
 {
@@ -58,5 +77,317 @@ LegacyFormatScope::~LegacyFormatScope()
     }
 }
 
+bool isLoadingInPlace()
+{
+    return IsLoadingInPlace;
+}
+
+InPlaceLoadScope::InPlaceLoadScope(bool inPlace)
+    : m_previousState(IsLoadingInPlace)
+{
+    IsLoadingInPlace = inPlace;
+}
+
+InPlaceLoadScope::~InPlaceLoadScope()
+{
+    IsLoadingInPlace = m_previousState;
+}
+
+bool isCompactFormat()
+{
+    return IsCompactFormat;
+}
+
+CompactFormatScope::CompactFormatScope(bool isCompact)
+    : m_previousState(IsCompactFormat)
+{
+    IsCompactFormat = isCompact;
+}
+
+CompactFormatScope::~CompactFormatScope()
+{
+    IsCompactFormat = m_previousState;
+}
+
+bool isIndexedFormat()
+{
+    return IsIndexedFormat;
+}
+
+IndexedFormatScope::IndexedFormatScope(bool isIndexed)
+    : m_previousState(IsIndexedFormat)
+{
+    IsIndexedFormat = isIndexed;
+}
+
+IndexedFormatScope::~IndexedFormatScope()
+{
+    IsIndexedFormat = m_previousState;
+}
+
+const SSSegmentPolicy& currentSegmentPolicy()
+{
+    return CurrentSegmentPolicy;
+}
+
+SegmentPolicyScope::SegmentPolicyScope(const SSSegmentPolicy& policy)
+    : m_previousPolicy(CurrentSegmentPolicy)
+{
+    CurrentSegmentPolicy = policy;
+}
+
+SegmentPolicyScope::~SegmentPolicyScope()
+{
+    CurrentSegmentPolicy = m_previousPolicy;
+}
+
+const std::optional<SSParallelSave>& currentParallelSave()
+{
+    return CurrentParallelSave;
+}
+
+ParallelSaveScope::ParallelSaveScope(const std::optional<SSParallelSave>& options)
+    : m_previousOptions(CurrentParallelSave)
+{
+    CurrentParallelSave = options;
+}
+
+ParallelSaveScope::~ParallelSaveScope()
+{
+    CurrentParallelSave = m_previousOptions;
+}
+
+const std::optional<SSParallelLoad>& currentParallelLoad()
+{
+    return CurrentParallelLoad;
+}
+
+ParallelLoadScope::ParallelLoadScope(const std::optional<SSParallelLoad>& options)
+    : m_previousOptions(CurrentParallelLoad)
+{
+    CurrentParallelLoad = options;
+}
+
+ParallelLoadScope::~ParallelLoadScope()
+{
+    CurrentParallelLoad = m_previousOptions;
+}
+
+namespace {
+
+// Threads of 'runTasks', started on demand and kept until exit
+class WorkerPool
+{
+public:
+    ~WorkerPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_isStopping = true;
+        }
+
+        m_condition.notify_all();
+
+        for (auto& x : m_threads)
+            x.join();
+    }
+
+    // Queues 'count' jobs, starting threads if there are fewer. Fewer jobs if threads can't be started.
+    void post(size_t count, const std::function<void()>& job) {
+        std::lock_guard lock(m_mutex);
+
+        try {
+            while (m_threads.size() < count)
+                m_threads.emplace_back([this]() { run(); });
+        } catch (const std::system_error&) {
+            count = m_threads.size();
+        }
+
+        for (size_t i = 0; i < count; i++)
+            m_jobs.push_back(job);
+
+        m_condition.notify_all();
+    }
+
+private:
+    void run() {
+        while (true) {
+            std::function<void()> job;
+
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_isStopping || !m_jobs.empty(); });
+
+                if (m_jobs.empty())
+                    return;
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            job();
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::function<void()>> m_jobs;
+    std::vector<std::thread> m_threads;
+    bool m_isStopping {false};
+};
+
+WorkerPool& workerPool()
+{
+    static WorkerPool pool;
+    return pool;
+}
+
+// Jobs of a 'runTasks' call. Jobs started after the caller is done are skipped,
+// so the caller doesn't wait for jobs queued by other calls.
+struct TasksBatch
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t running {0};
+    bool isClosed {false};
+};
+
+} // namespace
+
+void runTasks(size_t threads, size_t count, const std::function<void(size_t)>& task)
+{
+    if (!threads)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    threads = std::min(threads, count);
+
+    // E.g. 'std::pmr::monotonic_buffer_resource' would be a data race
+    if (!isThreadSafeResource(CurrentMemoryResource))
+        threads = 1;
+
+    const auto isLegacyBinary = OptIsProcessingLegacyBinFormat;
+    const bool isCompact = IsCompactFormat;
+    const bool isIndexed = IsIndexedFormat;
+    const auto policy = CurrentSegmentPolicy;
+    const auto resource = CurrentMemoryResource;
+
+    std::atomic<size_t> nextTask {0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto work = [&]() {
+        const auto wasLegacyBinary = OptIsProcessingLegacyBinFormat;
+        OptIsProcessingLegacyBinFormat = isLegacyBinary;
+        CompactFormatScope compactScope(isCompact);
+        IndexedFormatScope indexedScope(isIndexed);
+        SegmentPolicyScope policyScope(policy);
+        MemoryResourceScope resourceScope(resource);
+        ParallelSaveScope parallelSaveScope(std::nullopt);
+        ParallelLoadScope parallelLoadScope(std::nullopt);
+        SegmentSizesScope sizesScope(nullptr);
+
+        try {
+            for (auto i = nextTask++; i < count; i = nextTask++)
+                task(i);
+        } catch (...) {
+            std::lock_guard lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+            nextTask = count;
+        }
+
+        OptIsProcessingLegacyBinFormat = wasLegacyBinary;
+    };
+
+    if (threads > 1) {
+        // Tasks aren't bound to threads, so they're done by the ones which get to run
+        const auto batch = std::make_shared<TasksBatch>();
+        workerPool().post(threads - 1, [batch, &work]() {
+            {
+                std::lock_guard lock(batch->mutex);
+                if (batch->isClosed)
+                    return;
+
+                batch->running++;
+            }
+
+            work();
+
+            std::lock_guard lock(batch->mutex);
+            batch->running--;
+            batch->condition.notify_all();
+        });
+
+        work();
+
+        std::unique_lock lock(batch->mutex);
+        batch->isClosed = true;
+        batch->condition.wait(lock, [&batch]() { return !batch->running; });
+    } else {
+        work();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+const std::shared_ptr<const void>* sharedPayloadOwner(const void* object)
+{
+    if (CurrentSharedPayloadOwner && CurrentSharedPayloadOwner->get() == object)
+        return CurrentSharedPayloadOwner;
+
+    return nullptr;
+}
+
+SharedPayloadScope::SharedPayloadScope(const std::shared_ptr<const void>& owner)
+    : m_previousOwner(CurrentSharedPayloadOwner)
+{
+    CurrentSharedPayloadOwner = &owner;
+}
+
+SharedPayloadScope::~SharedPayloadScope()
+{
+    CurrentSharedPayloadOwner = m_previousOwner;
+}
+
+SegmentSizes* currentSegmentSizes()
+{
+    return CurrentSegmentSizes;
+}
+
+SegmentSizesScope::SegmentSizesScope(SegmentSizes* sizes)
+    : m_previousSizes(CurrentSegmentSizes)
+{
+    CurrentSegmentSizes = sizes;
+}
+
+SegmentSizesScope::~SegmentSizesScope()
+{
+    CurrentSegmentSizes = m_previousSizes;
+}
+
+std::pmr::memory_resource* currentMemoryResource()
+{
+    return CurrentMemoryResource;
+}
+
+bool isThreadSafeResource(std::pmr::memory_resource* resource)
+{
+    return !resource ||
+           resource == std::pmr::new_delete_resource() ||
+           dynamic_cast<std::pmr::synchronized_pool_resource*>(resource);
+}
+
+MemoryResourceScope::MemoryResourceScope(std::pmr::memory_resource* resource)
+    : m_previousResource(CurrentMemoryResource)
+{
+    CurrentMemoryResource = resource;
+}
+
+MemoryResourceScope::~MemoryResourceScope()
+{
+    CurrentMemoryResource = m_previousResource;
+}
+
 } // namespace Internal
 } // namespace SuitableStruct
@@ -4,6 +4,130 @@
 
 #include <SuitableStruct/Internals/LongSSO.h>
 
+#include <atomic>
+
 namespace SuitableStruct {
 
+namespace {
+
+constexpr size_t MaxPooledBuffers = 64;
+
+std::atomic<size_t> PoolLimit { SSDefaultBufferPoolLimit };
+
+// Buffers can be destroyed after the pool of their thread (by other thread-local or static objects).
+// Trivially destructible state tells whether the pool can still be used.
+enum class PoolState : uint8_t { NotCreated, Alive, Destroyed };
+thread_local PoolState CurrentPoolState = PoolState::NotCreated;
+
+void destroyBuffer(ExternalSSOBuffer* buffer)
+{
+    const auto resource = buffer->get_allocator().resource();
+    buffer->~ExternalSSOBuffer();
+    resource->deallocate(buffer, sizeof(ExternalSSOBuffer), alignof(ExternalSSOBuffer));
+}
+
+struct BufferPool
+{
+    BufferPool() {
+        buffers.reserve(MaxPooledBuffers);
+        CurrentPoolState = PoolState::Alive;
+    }
+
+    ~BufferPool() {
+        clear();
+        CurrentPoolState = PoolState::Destroyed;
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    void clear() {
+        for (auto x : buffers)
+            destroyBuffer(x);
+
+        buffers.clear();
+        stats.buffersRetained = 0;
+        stats.bytesRetained = 0;
+    }
+
+    std::vector<ExternalSSOBuffer*> buffers;
+    SSBufferPoolStats stats;
+};
+
+BufferPool* currentPool()
+{
+    if (CurrentPoolState == PoolState::Destroyed)
+        return nullptr;
+
+    static thread_local BufferPool pool;
+    return &pool;
+}
+
+} // namespace
+
+void ssSetBufferPoolLimit(size_t bytes)
+{
+    PoolLimit.store(bytes, std::memory_order_relaxed);
+}
+
+size_t ssBufferPoolLimit()
+{
+    return PoolLimit.load(std::memory_order_relaxed);
+}
+
+SSBufferPoolStats ssBufferPoolStats()
+{
+    const auto pool = currentPool();
+    return pool ? pool->stats : SSBufferPoolStats();
+}
+
+void ssClearBufferPool()
+{
+    if (const auto pool = currentPool())
+        pool->clear();
+}
+
+namespace Internal {
+
+ExternalSSOBuffer* takePooledBuffer()
+{
+    const auto pool = currentPool();
+    if (!pool)
+        return nullptr;
+
+    if (pool->buffers.empty()) {
+        pool->stats.misses++;
+        return nullptr;
+    }
+
+    const auto result = pool->buffers.back();
+    pool->buffers.pop_back();
+    pool->stats.hits++;
+    pool->stats.buffersRetained--;
+    pool->stats.bytesRetained -= result->capacity();
+    return result;
+}
+
+bool returnPooledBuffer(ExternalSSOBuffer* buffer)
+{
+    const auto pool = currentPool();
+    if (!pool)
+        return false;
+
+    const auto capacity = buffer->capacity();
+
+    if (pool->buffers.size() >= MaxPooledBuffers ||
+        pool->stats.bytesRetained + capacity > ssBufferPoolLimit() ||
+        capacity == 0)
+        return false;
+
+    buffer->clear();
+    pool->buffers.push_back(buffer);
+    pool->stats.buffersRetained++;
+    pool->stats.bytesRetained += capacity;
+    return true;
+}
+
+} // namespace Internal
+
 } // namespace SuitableStruct
@@ -0,0 +1,199 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <SuitableStruct/MappedFile.h>
+#include <SuitableStruct/Exceptions.h>
+#include <cerrno>
+#include <limits>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SuitableStruct {
+
+namespace {
+
+#ifdef _WIN32
+[[noreturn]] void throwLastError(const char* what)
+{
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+}
+#else
+[[noreturn]] void throwErrno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+#endif
+
+} // namespace
+
+MappedFile::MappedFile(const std::string& path)
+{
+    open(path);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    swap(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        swap(other);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+void MappedFile::swap(MappedFile& other) noexcept
+{
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    std::swap(m_isOpen, other.m_isOpen);
+#ifdef _WIN32
+    std::swap(m_fileHandle, other.m_fileHandle);
+    std::swap(m_mappingHandle, other.m_mappingHandle);
+#endif
+}
+
+#ifdef _WIN32
+
+void MappedFile::open(const std::string& path)
+{
+    close();
+
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throwLastError("Can't open file");
+
+    LARGE_INTEGER fileSize {};
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throwLastError("Can't get file size");
+    }
+
+    if (static_cast<uint64_t>(fileSize.QuadPart) > std::numeric_limits<size_t>::max()) {
+        CloseHandle(file);
+        Internal::throwTooLarge();
+    }
+
+    m_fileHandle = file;
+    m_isOpen = true;
+
+    if (!fileSize.QuadPart) // Empty files can't be mapped
+        return;
+
+    m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mappingHandle) {
+        close();
+        throwLastError("Can't map file");
+    }
+
+    const auto view = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        close();
+        throwLastError("Can't map file");
+    }
+
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+}
+
+void MappedFile::close()
+{
+    if (m_data)
+        UnmapViewOfFile(m_data);
+
+    if (m_mappingHandle)
+        CloseHandle(m_mappingHandle);
+
+    if (m_fileHandle)
+        CloseHandle(m_fileHandle);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+}
+
+#else
+
+void MappedFile::open(const std::string& path)
+{
+    close();
+
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throwErrno("Can't open file");
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        const auto error = errno;
+        ::close(fd);
+        errno = error;
+        throwErrno("Can't get file size");
+    }
+
+    if (static_cast<uint64_t>(st.st_size) > std::numeric_limits<size_t>::max()) {
+        ::close(fd);
+        Internal::throwTooLarge();
+    }
+
+    const auto size = static_cast<size_t>(st.st_size);
+    void* view = nullptr;
+
+    if (size) { // Empty files can't be mapped
+        view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            const auto error = errno;
+            ::close(fd);
+            errno = error;
+            throwErrno("Can't map file");
+        }
+
+        // Hash check & decoding go front to back
+        madvise(view, size, MADV_SEQUENTIAL);
+    }
+
+    // Mapping stays valid after descriptor is closed
+    ::close(fd);
+
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = size;
+    m_isOpen = true;
+}
+
+void MappedFile::close()
+{
+    if (m_data)
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+}
+
+#endif
+
+} // namespace SuitableStruct
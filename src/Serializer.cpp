@@ -10,6 +10,118 @@ namespace Internal {
 // Format constants
 const uint8_t SS_FORMAT_F0[SS_FORMAT_MARK_SIZE] = { 0, 0, 0, 0, 0 };  // Format F0, single-version, old hash algorithm
 const uint8_t SS_FORMAT_F1[SS_FORMAT_MARK_SIZE] = { 1, 0, 0, 0, 0 };  // Format F1, multiple versions segments, new hash algorithm
+const uint8_t SS_FORMAT_F2[SS_FORMAT_MARK_SIZE] = { 2, 0, 0, 0, 0 };  // Format F2, same as F1, CRC32C hash
+const uint8_t SS_FORMAT_F3[SS_FORMAT_MARK_SIZE] = { 3, 0, 0, 0, 0 };  // Format F3, compact F1 (varints), CRC32C hash
+const uint8_t SS_FORMAT_F4[SS_FORMAT_MARK_SIZE] = { 4, 0, 0, 0, 0 };  // Format F4, F1 with chunk-indexed containers, CRC32C hash
+
+const uint8_t* formatMark(SSDataFormat format)
+{
+    switch (format) {
+        case SSDataFormat::F1: return SS_FORMAT_F1;
+        case SSDataFormat::F2: return SS_FORMAT_F2;
+        case SSDataFormat::F3: return SS_FORMAT_F3;
+        case SSDataFormat::F4: return SS_FORMAT_F4;
+        case SSDataFormat::F0: break; // Legacy format is not written anymore
+    }
+
+    throwFormat();
+}
+
+uint32_t formatHash(SSDataFormat format, const void* ptr, size_t sz)
+{
+    switch (format) {
+        case SSDataFormat::F0: return ssHashRaw_F0(ptr, sz);
+        case SSDataFormat::F1: return ssHashRaw_F1(ptr, sz);
+        case SSDataFormat::F2:
+        case SSDataFormat::F3:
+        case SSDataFormat::F4: return ssHashRaw_F2(ptr, sz);
+    }
+
+    throwFormat();
+}
+
+uint32_t formatHashContinue(SSDataFormat format, uint32_t hash, const void* ptr, size_t sz)
+{
+    switch (format) {
+        case SSDataFormat::F0: break; // Not chunk-friendly
+        case SSDataFormat::F1: return ssHashRawContinue_F1(hash, ptr, sz);
+        case SSDataFormat::F2:
+        case SSDataFormat::F3:
+        case SSDataFormat::F4: return ssHashRawContinue_F2(hash, ptr, sz);
+    }
+
+    throwFormat();
+}
+
+namespace {
+
+std::optional<SSDataFormat> formatByMark(const uint8_t* data, size_t size)
+{
+    if (size < SS_FORMAT_MARK_SIZE)
+        return {};
+
+    if (memcmp(data, SS_FORMAT_F0, SS_FORMAT_MARK_SIZE) == 0) return SSDataFormat::F0;
+    if (memcmp(data, SS_FORMAT_F1, SS_FORMAT_MARK_SIZE) == 0) return SSDataFormat::F1;
+    if (memcmp(data, SS_FORMAT_F2, SS_FORMAT_MARK_SIZE) == 0) return SSDataFormat::F2;
+    if (memcmp(data, SS_FORMAT_F3, SS_FORMAT_MARK_SIZE) == 0) return SSDataFormat::F3;
+    if (memcmp(data, SS_FORMAT_F4, SS_FORMAT_MARK_SIZE) == 0) return SSDataFormat::F4;
+    return {};
+}
+
+bool isHashValid(const std::optional<SSDataFormat>& format, uint32_t hash, const uint8_t* data, size_t size)
+{
+    if (format == SSDataFormat::F2 || format == SSDataFormat::F3 || format == SSDataFormat::F4)
+        return hash == ssHashRaw_F2(data, size);
+
+    // F0 & F1 data is accepted with any of their hashes, the one matching mark is checked first
+    if (format == SSDataFormat::F0)
+        return hash == ssHashRaw_F0(data, size) || hash == ssHashRaw_F1(data, size);
+
+    return hash == ssHashRaw_F1(data, size) || hash == ssHashRaw_F0(data, size);
+}
+
+} // namespace
+
+SSFormatInfo readEnvelope(BufferReader& bufferReader, bool verifyHash)
+{
+    using HashType = decltype(std::declval<Buffer>().hash());
+    const auto envelopeStart = bufferReader.position();
+
+    if (bufferReader.rest() < sizeof(uint64_t) + sizeof(HashType))
+        throwIntegrity();
+
+    const auto size = bufferReader.read<uint64_t>();
+    const auto hash = bufferReader.read<HashType>();
+
+    if (bufferReader.rest() < size)
+        throwIntegrity();
+
+    if (size > std::numeric_limits<size_t>::max())
+        throwTooLarge();
+
+    const auto payloadStart = bufferReader.position();
+    const auto payload = bufferReader.data();
+    bufferReader.advance(static_cast<std::ptrdiff_t>(size));
+
+    const auto format = formatByMark(payload, size);
+
+    if (verifyHash && !isHashValid(format, hash, payload, size))
+        throwIntegrity();
+
+    if (!format) {
+        if (size < SS_FORMAT_MARK_SIZE)
+            throwOutOfRange();
+
+        throwFormat();
+    }
+
+    SSFormatInfo result;
+    result.format = *format;
+    result.payloadOffset = payloadStart - envelopeStart + SS_FORMAT_MARK_SIZE;
+    result.payloadSize = size - SS_FORMAT_MARK_SIZE;
+    result.totalSize = bufferReader.position() - envelopeStart;
+    return result;
+}
 
 } // namespace Internal
 
@@ -20,6 +132,18 @@ std::optional<SSDataFormat> ssDetectFormat(const Buffer& buffer)
 }
 
 std::optional<SSDataFormat> ssDetectFormat(BufferReader& bufferReader)
+{
+    const auto info = ssDetectFormatInfo(bufferReader);
+    return info ? std::optional<SSDataFormat>(info->format) : std::nullopt;
+}
+
+std::optional<SSFormatInfo> ssDetectFormatInfo(const Buffer& buffer)
+{
+    BufferReader reader(buffer);
+    return ssDetectFormatInfo(reader);
+}
+
+std::optional<SSFormatInfo> ssDetectFormatInfo(BufferReader& bufferReader)
 {
     // Save current position to restore later
     const size_t originalPosition = bufferReader.position();
@@ -28,35 +152,21 @@ std::optional<SSDataFormat> ssDetectFormat(BufferReader& bufferReader)
     const auto positionRestorer = std::unique_ptr<void, decltype(deleter)>((void*)(1), deleter);
 
     try {
-        const auto size = bufferReader.read<uint64_t>();
-        const auto hash = bufferReader.read<uint32_t>();
-
-        BufferReader payloadReader = bufferReader.readRaw(size);
-
-        const auto computedHashF1 = payloadReader.hash();
-        const auto computedHashF0 = ssHashRaw_F0(payloadReader.data(), payloadReader.size());
-
-        bool hashValid = (hash == computedHashF1) || (hash == computedHashF0);
-        if (!hashValid)
-            return {};
-
-        uint8_t formatMarker[Internal::SS_FORMAT_MARK_SIZE];
-        payloadReader.readRaw(formatMarker, sizeof(formatMarker));
-
-        const bool isF0 = memcmp(formatMarker, Internal::SS_FORMAT_F0, Internal::SS_FORMAT_MARK_SIZE) == 0;
-        const bool isF1 = !isF0 && memcmp(formatMarker, Internal::SS_FORMAT_F1, Internal::SS_FORMAT_MARK_SIZE) == 0;
-
-        if (isF0) {
-            return SSDataFormat::F0;
-        } else if (isF1) {
-            return SSDataFormat::F1;
-        } else {
-            return {};
-        }
-
+        return Internal::readEnvelope(bufferReader, true);
     } catch (...) {
         return {};
     }
 }
 
+bool ssVerify(const Buffer& buffer)
+{
+    BufferReader reader(buffer);
+    return ssVerify(reader);
+}
+
+bool ssVerify(BufferReader& bufferReader)
+{
+    return ssDetectFormatInfo(bufferReader).has_value();
+}
+
 } // namespace SuitableStruct
@@ -37,6 +37,102 @@ struct Struct1
     SS_COMPARISONS_MEMBER_ONLY_EQ(Struct1);
 };
 
+// Multi-step upgrade chain: v0 -> v4
+struct Record_v0
+{
+    int64_t id{};
+    std::string name;
+    std::vector<double> values;
+
+    using ssVersions = std::tuple<Record_v0>;
+    auto ssTuple() const { return std::tie(id, name, values); }
+};
+
+struct Record_v1
+{
+    int64_t id{};
+    std::string name;
+    std::vector<double> values;
+    int flags{};
+
+    using ssVersions = std::tuple<Record_v0, Record_v1>;
+    auto ssTuple() const { return std::tie(id, name, values, flags); }
+    void ssUpgradeFrom(Record_v0&& prev) { id = prev.id; name = std::move(prev.name); values = std::move(prev.values); }
+};
+
+struct Record_v2
+{
+    int64_t id{};
+    std::string name;
+    std::vector<double> values;
+    int flags{};
+    std::string comment;
+
+    using ssVersions = std::tuple<Record_v0, Record_v1, Record_v2>;
+    auto ssTuple() const { return std::tie(id, name, values, flags, comment); }
+    void ssUpgradeFrom(Record_v1&& prev) { id = prev.id; name = std::move(prev.name); values = std::move(prev.values); flags = prev.flags; }
+};
+
+struct Record_v3
+{
+    int64_t id{};
+    std::string name;
+    std::vector<double> values;
+    int flags{};
+    std::string comment;
+    double scale{1.0};
+
+    using ssVersions = std::tuple<Record_v0, Record_v1, Record_v2, Record_v3>;
+    auto ssTuple() const { return std::tie(id, name, values, flags, comment, scale); }
+    void ssUpgradeFrom(Record_v2&& prev) { id = prev.id; name = std::move(prev.name); values = std::move(prev.values); flags = prev.flags; comment = std::move(prev.comment); }
+};
+
+struct Record_v4
+{
+    int64_t id{};
+    std::string name;
+    std::vector<double> values;
+    int flags{};
+    std::string comment;
+    double scale{1.0};
+    uint32_t revision{};
+
+    using ssVersions = std::tuple<Record_v0, Record_v1, Record_v2, Record_v3, Record_v4>;
+    auto ssTuple() const { return std::tie(id, name, values, flags, comment, scale, revision); }
+    void ssUpgradeFrom(Record_v3&& prev) { id = prev.id; name = std::move(prev.name); values = std::move(prev.values); flags = prev.flags; comment = std::move(prev.comment); scale = prev.scale; }
+};
+
+// Nested custom savers, each level keeps its Buffer alive while saving the next one
+template<int Depth>
+struct Node
+{
+    std::string name { "node" };
+    int value { Depth };
+    Node<Depth - 1> child;
+
+    SuitableStruct::Buffer ssSaveImpl() const {
+        auto result = SuitableStruct::ssSaveImpl(name);
+        result += SuitableStruct::ssSaveImpl(value);
+        result += SuitableStruct::ssSaveImpl(child);
+        return result;
+    }
+};
+
+template<>
+struct Node<0>
+{
+    std::string name { "leaf" };
+    SuitableStruct::Buffer ssSaveImpl() const { return SuitableStruct::ssSaveImpl(name); }
+};
+
+std::vector<Record_v0> makeRecords(size_t count)
+{
+    std::vector<Record_v0> result(count);
+    for (size_t i = 0; i < count; i++)
+        result[i] = {static_cast<int64_t>(i), "record", {1.0, 2.0, 3.0}};
+    return result;
+}
+
 } // namespace
 
 static void StubBenchmark(benchmark::State& state)
@@ -64,6 +160,45 @@ static void serialization_raw(benchmark::State& state)
 BENCHMARK(serialization_raw);
 
 
+// Run with different SUITABLE_STRUCT_BUFFER_INLINE_CAPACITY to compare 'Buffer' layouts
+static void serialization_deep(benchmark::State& state)
+{
+    const std::vector<Node<8>> value(static_cast<size_t>(state.range(0)));
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssSave(value);
+        benchmark::DoNotOptimize(result.cdata());
+    }
+    state.counters["sizeof(Buffer)"] = sizeof(SuitableStruct::Buffer);
+}
+
+BENCHMARK(serialization_deep)->Arg(1)->Arg(100);
+
+
+// Inline capacities side by side: nested temporaries of typical segment size appended to parent
+template<size_t Capacity>
+static void inline_capacity(benchmark::State& state)
+{
+    const uint8_t payload[48] {};
+    const auto depth = state.range(0);
+
+    while (state.KeepRunning()) {
+        SuitableStruct::LongSSO<Capacity> root;
+        for (int64_t i = 0; i < depth; i++) {
+            SuitableStruct::LongSSO<Capacity> part;
+            part.appendData(payload, sizeof(payload));
+            root.appendData(part.cdata(), part.size());
+        }
+        benchmark::DoNotOptimize(root.cdata());
+    }
+    state.counters["sizeof"] = sizeof(SuitableStruct::LongSSO<Capacity>);
+}
+
+BENCHMARK_TEMPLATE(inline_capacity, 0)->Arg(1)->Arg(16);
+BENCHMARK_TEMPLATE(inline_capacity, 16)->Arg(1)->Arg(16);
+BENCHMARK_TEMPLATE(inline_capacity, 80)->Arg(1)->Arg(16);
+BENCHMARK_TEMPLATE(inline_capacity, 256)->Arg(1)->Arg(16);
+
+
 #ifdef SUITABLE_STRUCT_HAS_QT_LIBRARY
 static void serialization_json(benchmark::State& state)
 {
@@ -76,3 +211,93 @@ static void serialization_json(benchmark::State& state)
 
 BENCHMARK(serialization_json);
 #endif // SUITABLE_STRUCT_HAS_QT_LIBRARY
+
+
+static void serialization_large(benchmark::State& state)
+{
+    const std::vector<std::string> value(static_cast<size_t>(state.range(0)), std::string(1024, 'x'));
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssSave(value, false); // Buffer growth, not hashing
+        benchmark::DoNotOptimize(result.cdata());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 1024);
+}
+
+BENCHMARK(serialization_large)->Arg(4096);
+
+
+// Repeated saves of the same shape, arg: buffer pool enabled
+static void serialization_pool(benchmark::State& state)
+{
+    const auto records = makeRecords(20);
+    SuitableStruct::ssSetBufferPoolLimit(state.range(0) ? SuitableStruct::SSDefaultBufferPoolLimit : 0);
+    SuitableStruct::ssClearBufferPool();
+
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssSave(records);
+        benchmark::DoNotOptimize(result.cdata());
+    }
+
+    SuitableStruct::ssSetBufferPoolLimit(SuitableStruct::SSDefaultBufferPoolLimit);
+}
+
+BENCHMARK(serialization_pool)->Arg(0)->Arg(1);
+
+
+// Arg: threads, 1 is sequential
+static void serialization_parallel(benchmark::State& state)
+{
+    const auto records = makeRecords(100000);
+    const SuitableStruct::SSParallelSave parallel {static_cast<size_t>(state.range(0)), 4096};
+
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssSave(records, parallel);
+        benchmark::DoNotOptimize(result.cdata());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+BENCHMARK(serialization_parallel)->Arg(1)->Arg(4)->UseRealTime();
+
+
+// Format F4, arg: threads, 1 is sequential
+static void deserialization_parallel(benchmark::State& state)
+{
+    const auto records = makeRecords(100000);
+    const auto saved = SuitableStruct::ssSave(records, SuitableStruct::SSDataFormat::F4);
+    const SuitableStruct::SSParallelLoad parallel {static_cast<size_t>(state.range(0))};
+
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssLoadRet<std::vector<Record_v0>>(saved, parallel);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+BENCHMARK(deserialization_parallel)->Arg(1)->Arg(4)->UseRealTime();
+
+
+static void upgrade_chain(benchmark::State& state)
+{
+    const auto saved = SuitableStruct::ssSave(makeRecords(static_cast<size_t>(state.range(0))));
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssLoadRet<std::vector<Record_v4>>(saved);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(upgrade_chain)->Arg(100)->Arg(10000);
+
+
+static void upgrade_chain_baseline(benchmark::State& state)
+{
+    const auto saved = SuitableStruct::ssSave(makeRecords(static_cast<size_t>(state.range(0))));
+    while (state.KeepRunning()) {
+        const auto result = SuitableStruct::ssLoadRet<std::vector<Record_v0>>(saved);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(upgrade_chain_baseline)->Arg(100)->Arg(10000);
@@ -503,3 +503,57 @@ TEST_F(LongSSOTest, StressTest) {
     EXPECT_EQ(sso.size(), 0);
     EXPECT_FALSE(sso);
 }
+
+// Test capacity management
+TEST_F(LongSSOTest, Capacity) {
+    LongSSO<10> sso;
+    EXPECT_EQ(sso.capacity(), 10);
+
+    sso.appendData(reinterpret_cast<const uint8_t*>("abc"), 3);
+    sso.reserve(1000);
+    EXPECT_FALSE(sso.isShortBuf());
+    EXPECT_GE(sso.capacity(), 1000);
+    const auto data = sso.data();
+
+    // No reallocation within reserved capacity
+    const auto target = sso.allocate_copy(900);
+    EXPECT_EQ(sso.data(), data);
+    memset(target, 'x', 900);
+    EXPECT_EQ(sso.size(), 903);
+
+    sso.reduceSize(800);
+    sso.shrink_to_fit();
+    EXPECT_FALSE(sso.isShortBuf());
+    EXPECT_LT(sso.capacity(), 1000);
+
+    // Back to short buffer
+    sso.reduceSize(98);
+    sso.shrink_to_fit();
+    EXPECT_TRUE(sso.isShortBuf());
+    EXPECT_EQ(sso.capacity(), 10);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(sso.data()), sso.size()), "abcxx");
+
+    // Grows again after shrinking
+    sso.appendData(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    EXPECT_FALSE(sso.isShortBuf());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(sso.data()), sso.size()), "abcxx0123456789");
+}
+
+TEST_F(LongSSOTest, CapacityExternalBuffer) {
+    ExternalSSOBuffer buffer;
+    LongSSO<5> sso(buffer);
+
+    sso.appendData(reinterpret_cast<const uint8_t*>("0123456789"), 10);
+    EXPECT_EQ(sso.data(), buffer.data());
+
+    sso.reduceSize(7);
+    sso.shrink_to_fit();
+    EXPECT_TRUE(sso.isShortBuf());
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(sso.data()), sso.size()), "012");
+
+    // External buffer is still used
+    sso.appendData(reinterpret_cast<const uint8_t*>("3456789"), 7);
+    EXPECT_EQ(sso.data(), buffer.data());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(sso.data()), sso.size()), "0123456789");
+}
@@ -3,6 +3,7 @@
  * Contact:  ihor-drachuk-libs@pm.me  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <stdexcept>
 #include <SuitableStruct/Buffer.h>
 #include <SuitableStruct/BufferReader.h>
@@ -52,11 +53,13 @@ void bufferTester()
 
 TEST(SuitableStruct, BufferTest)
 {
-    bufferTester<LongSSO<>::getSsoLimit() / 2>();
-    bufferTester<LongSSO<>::getSsoLimit() - 1>();
-    bufferTester<LongSSO<>::getSsoLimit()>();
-    bufferTester<LongSSO<>::getSsoLimit() + 1>();
-    bufferTester<LongSSO<>::getSsoLimit() * 2>();
+    // Around inline capacity, tester needs at least 10 bytes
+    constexpr auto limit = std::max<size_t>(Buffer::InlineCapacity, 11);
+    bufferTester<std::max<size_t>(limit / 2, 10)>();
+    bufferTester<limit - 1>();
+    bufferTester<limit>();
+    bufferTester<limit + 1>();
+    bufferTester<limit * 2>();
     bufferTester<10>();
 }
 
@@ -131,3 +134,29 @@ TEST(SuitableStruct, BufferReader_SeekBeyondBounds)
     ASSERT_THROW(reader.seek(6), std::out_of_range);
     ASSERT_THROW(reader.seek(100), std::out_of_range);
 }
+
+TEST(SuitableStruct, BufferTest_Capacity)
+{
+    Buffer buf;
+    buf.reserve(10000);
+    ASSERT_GE(buf.capacity(), 10000);
+    const auto data = buf.cdata();
+
+    for (int i = 0; i < 1000; i++)
+        buf.write(i);
+    ASSERT_EQ(buf.cdata(), data);
+
+    auto ptr = buf.allocate(4);
+    memcpy(ptr, "abcd", 4);
+    ASSERT_EQ(buf.size(), 4004);
+    ASSERT_EQ(memcmp(buf.cdata() + 4000, "abcd", 4), 0);
+
+    buf.reduceSize(4000);
+    buf.shrink_to_fit();
+    ASSERT_LT(buf.capacity(), 10000);
+    ASSERT_EQ(buf, Buffer::fromValue(0));
+
+    // Zero-filled
+    const Buffer zeros(1000);
+    ASSERT_EQ(std::count(zeros.cdata(), zeros.cdata() + zeros.size(), 0), 1000);
+}
@@ -0,0 +1,175 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/map.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Leaf
+{
+    int a {};
+    std::string b;
+
+    auto ssTuple() const { return std::tie(a, b); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Leaf)
+};
+
+struct Custom
+{
+    int x {};
+
+    Buffer ssSaveImpl() const { return Buffer::fromValue(x); }
+    void ssLoadImpl(BufferReader& src) { src.read(x); }
+    bool operator==(const Custom& rhs) const { return x == rhs.x; }
+    bool operator!=(const Custom& rhs) const { return !(*this == rhs); }
+};
+
+struct Node
+{
+    Leaf leaf;
+    Custom custom;
+    std::optional<Leaf> optLeaf;
+    std::vector<Leaf> leaves;
+    std::map<std::string, Leaf> named;
+    std::variant<int, Leaf> var;
+
+    auto ssTuple() const { return std::tie(leaf, custom, optLeaf, leaves, named, var); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Node)
+};
+
+struct Deep
+{
+    Node node;
+    std::vector<Node> children;
+
+    auto ssTuple() const { return std::tie(node, children); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Deep)
+};
+
+Leaf makeLeaf(int i)
+{
+    return Leaf{i, std::string(static_cast<size_t>(i % 7) * 20, 'a' + static_cast<char>(i % 26))};
+}
+
+Node makeNode(int i)
+{
+    Node node;
+    node.leaf = makeLeaf(i);
+    node.custom.x = i * 3;
+    node.optLeaf = makeLeaf(i + 1);
+    for (int j = 0; j < 5; j++) {
+        node.leaves.push_back(makeLeaf(i + j));
+        node.named.emplace(std::to_string(j), makeLeaf(i * j));
+    }
+    node.var = makeLeaf(i + 2);
+    return node;
+}
+
+} // namespace
+
+TEST(SuitableStruct, BufferWriter_PlaceholderAndPatch)
+{
+    Buffer buffer = Buffer::fromConstChar("xyz");
+    BufferWriter writer(buffer);
+
+    ASSERT_EQ(writer.offsetStart(), 3);
+    ASSERT_EQ(writer.position(), 0);
+
+    const auto pos = writer.writePlaceholder<uint32_t>();
+    writer.write(static_cast<uint8_t>(7));
+    writer.patch(pos, static_cast<uint32_t>(0x01020304));
+
+    ASSERT_EQ(writer.position(), 5);
+    ASSERT_EQ(buffer.size(), 8);
+
+    BufferReader reader(buffer, 3);
+    ASSERT_EQ(reader.read<uint32_t>(), 0x01020304u);
+    ASSERT_EQ(reader.read<uint8_t>(), 7);
+
+    ASSERT_THROW(writer.patch(2, static_cast<uint32_t>(0)), std::out_of_range);
+    ASSERT_THROW(writer.hash(4, 2), std::out_of_range);
+}
+
+TEST(SuitableStruct, BufferWriter_WireFormatUnchanged)
+{
+    // Segment framing of each class instance: count, version, uint64 size, payload
+    const Leaf leaf {42, "hi"};
+
+    Buffer stringPayload;
+    stringPayload.write(static_cast<uint8_t>(1));  // segments count
+    stringPayload.write(static_cast<uint8_t>(0));  // version
+    stringPayload.write(static_cast<uint64_t>(sizeof(uint64_t) + 2));
+    stringPayload.write(static_cast<uint64_t>(2));
+    stringPayload.writeRaw("hi", 2);
+
+    Buffer expectedPayload;
+    expectedPayload.write(static_cast<uint8_t>(1));  // segments count
+    expectedPayload.write(static_cast<uint8_t>(0));  // version
+    expectedPayload.write(static_cast<uint64_t>(sizeof(int) + stringPayload.size()));
+    expectedPayload.write(42);
+    expectedPayload += stringPayload;
+
+    ASSERT_EQ(ssSave(leaf, false), expectedPayload);
+
+    Buffer expectedProtected;
+    Buffer body;
+    body.writeRaw(Internal::SS_FORMAT_F1, Internal::SS_FORMAT_MARK_SIZE);
+    body += expectedPayload;
+    expectedProtected.write(static_cast<uint64_t>(body.size()));
+    expectedProtected.write(body.hash());
+    expectedProtected += body;
+
+    ASSERT_EQ(ssSave(leaf), expectedProtected);
+}
+
+TEST(SuitableStruct, BufferWriter_SaveToAppends)
+{
+    Deep value;
+    value.node = makeNode(1);
+    for (int i = 0; i < 10; i++)
+        value.children.push_back(makeNode(i));
+
+    const auto standalone = ssSave(value);
+
+    Buffer buffer = Buffer::fromConstChar("prefix");
+    BufferWriter writer(buffer);
+    ssSaveTo(writer, value);
+    ssSaveTo(writer, value, false);
+
+    ASSERT_EQ(buffer.size(), 6 + standalone.size() + ssSave(value, false).size());
+    ASSERT_EQ(memcmp(buffer.cdata(), "prefix", 6), 0);
+    ASSERT_EQ(Buffer(buffer.cdata() + 6, standalone.size()), standalone);
+
+    BufferReader reader(buffer, 6);
+    Deep loaded1, loaded2;
+    ssLoad(reader, loaded1);
+    ssLoad(reader, loaded2, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(reader.rest(), 0);
+    ASSERT_EQ(loaded1, value);
+    ASSERT_EQ(loaded2, value);
+}
+
+TEST(SuitableStruct, BufferWriter_LegacyBufferApiMatches)
+{
+    const auto node = makeNode(5);
+
+    // Buffer-returning functions stay available for custom handlers
+    Buffer viaInternal = ssSaveInternal(node);
+    Buffer viaWriter;
+    BufferWriter writer(viaWriter);
+    ssSaveInternal(writer, node);
+    ASSERT_EQ(viaInternal, viaWriter);
+
+    Buffer implViaWriter;
+    BufferWriter implWriter(implViaWriter);
+    ssSaveImplInternal(implWriter, node.leaves);
+    ASSERT_EQ(ssSaveImpl(node.leaves), implViaWriter);
+}
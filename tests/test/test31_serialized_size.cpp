@@ -0,0 +1,216 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Containers/array.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/list.h>
+#include <SuitableStruct/Containers/map.h>
+#include <SuitableStruct/Containers/set.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+enum class Color : uint16_t { Red, Green };
+
+struct Point
+{
+    int x {};
+    int y {};
+
+    auto ssTuple() const { return std::tie(x, y); }
+};
+
+struct FixedStruct
+{
+    Point pt;
+    Color color {};
+    std::pair<uint8_t, double> pair;
+    std::array<Point, 3> points;
+    std::chrono::milliseconds duration {};
+    std::chrono::system_clock::time_point tp;
+
+    auto ssTuple() const { return std::tie(pt, color, pair, points, duration, tp); }
+};
+
+struct CustomType
+{
+    int value {};
+
+    Buffer ssSaveImpl() const { return Buffer::fromValue(value) + Buffer::fromValue(value); }
+    void ssLoadImpl(BufferReader& src) { src.read(value); src.read(value); }
+};
+
+// Custom savers providing their size, counting payloads made
+struct Digest
+{
+    static inline int saves = 0;
+    std::array<uint8_t, 4> bytes {};
+
+    Buffer ssSaveImpl() const { saves++; return Buffer(bytes.data(), bytes.size()); }
+    size_t ssSerializedSizeImpl() const { return bytes.size(); }
+    void ssLoadImpl(BufferReader& src) { src.readRaw(bytes.data(), bytes.size()); }
+    bool operator==(const Digest& rhs) const { return bytes == rhs.bytes; }
+};
+
+struct Tag
+{
+    uint16_t id {};
+    bool operator==(const Tag& rhs) const { return id == rhs.id; }
+};
+
+struct Signed
+{
+    std::string text;
+    Digest digest;
+    std::vector<Tag> tags;
+
+    auto ssTuple() const { return std::tie(text, digest, tags); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Signed)
+};
+
+struct Dynamic
+{
+    std::string str;
+    std::optional<Point> optPoint;
+    std::vector<Point> points;
+    std::vector<std::string> strings;
+    std::map<std::string, std::vector<int>> named;
+    std::list<std::variant<int, std::string>> vars;
+    std::set<int> ints;
+    std::shared_ptr<Point> shared;
+    std::unique_ptr<std::string> unique;
+    std::tuple<int, std::string, std::monostate> tuple;
+    CustomType custom;
+
+    auto ssTuple() const { return std::tie(str, optPoint, points, strings, named, vars, ints, shared, unique, tuple, custom); }
+};
+
+// Fixed-size old version, dynamic new one
+struct Weight_v0
+{
+    double value {};
+    using ssVersions = std::tuple<Weight_v0>;
+    auto ssTuple() const { return std::tie(value); }
+};
+
+struct Weight_v1
+{
+    double value {};
+    std::string unit;
+    using ssVersions = std::tuple<Weight_v0, Weight_v1>;
+    auto ssTuple() const { return std::tie(value, unit); }
+
+    void ssUpgradeFrom(const Weight_v0& prev) { value = prev.value; unit = "kg"; }
+    void ssDowngradeTo(Weight_v0& next) const { next.value = value; }
+};
+
+template<typename T>
+void checkSize(const T& value)
+{
+    ASSERT_EQ(ssSerializedSize(value), ssSave(value).size());
+    ASSERT_EQ(ssSerializedSize(value, false), ssSave(value, false).size());
+}
+
+} // namespace
+
+namespace SuitableStruct {
+
+template<>
+struct Handlers<Tag> : public std::true_type
+{
+    static inline int saves = 0;
+
+    static Buffer ssSaveImpl(const Tag& value) { saves++; return Buffer::fromValue(value.id); }
+    static size_t ssSerializedSizeImpl(const Tag&) { return sizeof(uint16_t); }
+    static void ssLoadImpl(BufferReader& src, Tag& value) { src.read(value.id); }
+};
+
+} // namespace SuitableStruct
+
+TEST(SuitableStruct, SerializedSize_Fixed)
+{
+    static_assert(SSFixedSize<int>::value);
+    static_assert(SSFixedSize<int>::size == sizeof(int));
+    static_assert(SSFixedSize<Point>::size == Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + 2 * sizeof(int));
+    static_assert(SSFixedSize<FixedStruct>::value);
+    static_assert(ssFixedSerializedSize<Point>() == Internal::SS_PROTECTED_HEADER_SIZE + SSFixedSize<Point>::size);
+    static_assert(ssFixedSerializedSize<Point>(false) == SSFixedSize<Point>::size);
+
+    static_assert(!SSFixedSize<std::string>::value);
+    static_assert(!SSFixedSize<Dynamic>::value);
+    static_assert(!SSFixedSize<CustomType>::value);
+    static_assert(!SSFixedSize<Weight_v1>::value);
+    static_assert(SSFixedSize<Weight_v0>::value);
+
+    checkSize(42);
+    checkSize(Color::Green);
+    checkSize(Point{1, 2});
+
+    FixedStruct fixed;
+    fixed.points[1].x = 5;
+    fixed.tp = std::chrono::system_clock::now();
+    checkSize(fixed);
+    ASSERT_EQ(ssSave(fixed).size(), ssFixedSerializedSize<FixedStruct>());
+
+    checkSize(std::chrono::steady_clock::now());
+}
+
+TEST(SuitableStruct, SerializedSize_Dynamic)
+{
+    Dynamic value;
+    checkSize(value);
+
+    value.str = "Hello, world!";
+    value.optPoint = Point{3, 4};
+    value.points.resize(10);
+    value.strings = {"a", "bb", "", std::string(200, 'c')};
+    value.named["x"] = {1, 2, 3};
+    value.named["yy"] = {};
+    value.vars = {1, std::string("two"), 3};
+    value.ints = {5, 6, 7};
+    value.shared = std::make_shared<Point>();
+    value.unique = std::make_unique<std::string>("unique");
+    value.tuple = {1, "tuple", {}};
+    value.custom.value = 9;
+    checkSize(value);
+
+    checkSize(std::vector<Dynamic>(3));
+    checkSize(std::optional<Dynamic>());
+}
+
+TEST(SuitableStruct, SerializedSize_Versioned)
+{
+    // Segments of all versions from the downgrade chain are counted
+    const Weight_v1 value {1.5, "lb"};
+    checkSize(value);
+    checkSize(std::vector<Weight_v1>{value, value});
+}
+
+TEST(SuitableStruct, SerializedSize_CustomHook)
+{
+    const Signed value {"text", Digest{{1, 2, 3, 4}}, {Tag{1}, Tag{2}, Tag{3}}};
+
+    // Measured without making payloads
+    Digest::saves = 0;
+    Handlers<Tag>::saves = 0;
+    for (auto format : {SSDataFormat::F1, SSDataFormat::F3}) {
+        const auto size = ssSerializedSize(value, format);
+        ASSERT_EQ(Digest::saves, 0);
+        ASSERT_EQ(Handlers<Tag>::saves, 0);
+
+        // Compact format measures segments before writing them, payloads are still made once
+        const auto saved = ssSave(value, format);
+        ASSERT_EQ(saved.size(), size);
+        ASSERT_EQ(Digest::saves, 1);
+        ASSERT_EQ(Handlers<Tag>::saves, 3);
+        ASSERT_EQ(ssLoadRet<Signed>(saved), value);
+
+        Digest::saves = 0;
+        Handlers<Tag>::saves = 0;
+    }
+}
@@ -0,0 +1,86 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Containers/array.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/list.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+enum class Level : uint8_t { Low, Mid, High };
+
+static_assert(IsContiguousContainer<std::vector<int>>::value);
+static_assert(IsContiguousContainer<std::array<double, 4>>::value);
+static_assert(!IsContiguousContainer<std::vector<bool>>::value);
+static_assert(!IsContiguousContainer<std::list<int>>::value);
+
+// Item-by-item writing, as before the bulk path
+template<typename C>
+Buffer saveItemByItem(const C& value)
+{
+    Buffer payload;
+    payload.write(static_cast<uint64_t>(value.size()));
+    for (const auto& x : value)
+        payload.write(static_cast<typename C::value_type>(x));
+
+    Buffer result;
+    result.write(static_cast<uint8_t>(1));  // segments count
+    result.write(static_cast<uint8_t>(0));  // version
+    result.write(static_cast<uint64_t>(payload.size()));
+    result += payload;
+    return result;
+}
+
+template<typename C>
+void checkRoundTrip(const C& value)
+{
+    const auto saved = ssSave(value, false);
+    ASSERT_EQ(saved, saveItemByItem(value));
+    ASSERT_EQ(saved, ssSave(std::list<typename C::value_type>(value.begin(), value.end()), false));
+    ASSERT_EQ(ssLoadRet<C>(ssSave(value)), value);
+}
+
+} // namespace
+
+TEST(SuitableStruct, ContiguousContainers_WireFormat)
+{
+    std::vector<int> ints(1000);
+    for (size_t i = 0; i < ints.size(); i++)
+        ints[i] = static_cast<int>(i * 7) - 300;
+
+    checkRoundTrip(ints);
+    checkRoundTrip(std::vector<int>());
+    checkRoundTrip(std::vector<double>{1.5, -2.25, 1e300});
+    checkRoundTrip(std::vector<Level>{Level::High, Level::Low, Level::Mid});
+    checkRoundTrip(std::vector<bool>{true, false, true});
+    checkRoundTrip(std::array<uint16_t, 5>{1, 2, 3, 4, 5});
+
+    // Empty data over existing items
+    ssLoadInPlace(ssSave(std::vector<int>()), ints);
+    ASSERT_TRUE(ints.empty());
+}
+
+TEST(SuitableStruct, ContiguousContainers_Corrupted)
+{
+    // Count larger than the rest of data
+    Buffer buffer;
+    buffer.write(static_cast<uint64_t>(1000));
+    buffer.write(static_cast<int>(1));
+    std::vector<int> ints;
+    ASSERT_THROW(ssLoad(buffer, ints, SSLoadMode::NonProtectedDefault), std::out_of_range);
+
+    Buffer hugeCount;
+    hugeCount.write(std::numeric_limits<uint64_t>::max());
+    ASSERT_THROW(ssLoad(hugeCount, ints, SSLoadMode::NonProtectedDefault), std::out_of_range);
+
+    // More items than std::array can hold
+    const auto saved = ssSave(std::array<int, 3>{1, 2, 3}, false);
+    std::array<int, 2> arr {};
+    ASSERT_THROW(ssLoad(saved, arr, SSLoadMode::NonProtectedDefault), std::out_of_range);
+}
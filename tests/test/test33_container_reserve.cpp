@@ -0,0 +1,80 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/unordered_map.h>
+#include <SuitableStruct/Containers/unordered_set.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+// Vector which remembers requested reservations
+struct TrackingVector : public std::vector<std::string>
+{
+    using std::vector<std::string>::vector;
+
+    void reserve(size_t count) {
+        reserved.push_back(count);
+        std::vector<std::string>::reserve(count);
+    }
+
+    std::vector<size_t> reserved;
+};
+
+} // namespace
+
+template<> struct SuitableStruct::IsContainer<TrackingVector> : public std::true_type { };
+
+TEST(SuitableStruct, ContainerReserve_Reserved)
+{
+    const TrackingVector value {"a", "bb", "ccc"};
+    const auto saved = ssSave(value, false);
+
+    TrackingVector loaded;
+    ssLoad(saved, loaded, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(static_cast<const std::vector<std::string>&>(loaded), static_cast<const std::vector<std::string>&>(value));
+    ASSERT_EQ(loaded.reserved, std::vector<size_t>{3});
+
+    std::vector<std::string> strings(100, "abc");
+    const auto loadedStrings = ssLoadRet<std::vector<std::string>>(ssSave(strings));
+    ASSERT_EQ(loadedStrings, strings);
+    ASSERT_EQ(loadedStrings.capacity(), strings.size());
+
+    std::unordered_map<int, std::string> map;
+    for (int i = 0; i < 1000; i++)
+        map.emplace(i, std::to_string(i));
+    ASSERT_EQ(ssLoadRet<decltype(map)>(ssSave(map)), map);
+
+    const std::unordered_set<int> set {1, 2, 3, 4, 5};
+    ASSERT_EQ(ssLoadRet<decltype(set)>(ssSave(set)), set);
+}
+
+TEST(SuitableStruct, ContainerReserve_ClampedByInput)
+{
+    // Corrupted count must not lead to a huge allocation
+    Buffer buffer;
+    buffer.write(static_cast<uint8_t>(1));   // segments count
+    buffer.write(static_cast<uint8_t>(0));   // version
+    buffer.write(static_cast<uint64_t>(100));
+    buffer.write(std::numeric_limits<uint64_t>::max() / 2);
+    buffer.writeZeros(92);
+
+    // Zeros are not valid items: loading fails on the first one instead of reservation (std::length_error / std::bad_alloc)
+    TrackingVector loaded;
+    ASSERT_THROW(ssLoad(buffer, loaded, SSLoadMode::NonProtectedDefault), VersionError);
+
+    std::unordered_map<int, int> map;
+    ASSERT_THROW(ssLoad(buffer, map, SSLoadMode::NonProtectedDefault), VersionError);
+
+    Buffer stringBuffer;
+    stringBuffer.write(std::numeric_limits<uint64_t>::max());
+    BufferReader stringReader(stringBuffer);
+    std::string str;
+    ASSERT_THROW(ssLoadImpl(stringReader, str), std::out_of_range);
+}
@@ -0,0 +1,205 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/map.h>
+#include <SuitableStruct/Containers/unordered_map.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Item
+{
+    int id {};
+    std::string name;
+
+    auto ssTuple() const { return std::tie(id, name); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Item)
+};
+
+// Custom loader appends, so it must always get a fresh object
+struct Appender
+{
+    std::vector<int> values;
+
+    Buffer ssSaveImpl() const { return ssSave(values, false); }
+    void ssLoadImpl(BufferReader& src) {
+        const auto loaded = ssLoadRet<std::vector<int>>(src, SSLoadMode::NonProtectedDefault);
+        values.insert(values.end(), loaded.begin(), loaded.end());
+    }
+
+    bool operator==(const Appender& rhs) const { return values == rhs.values; }
+    bool operator!=(const Appender& rhs) const { return !(*this == rhs); }
+};
+
+struct Message
+{
+    std::string text;
+    std::vector<int> samples;
+    std::vector<Item> items;
+    std::map<int, std::string> named;
+    std::unordered_map<std::string, Item> index;
+    std::optional<Item> optItem;
+    std::variant<int, Item> var;
+    std::unique_ptr<Item> ptr;
+    Appender appender;
+
+    auto ssTuple() const { return std::tie(text, samples, items, named, index, optItem, var, ptr, appender); }
+
+    bool operator==(const Message& rhs) const {
+        return text == rhs.text && samples == rhs.samples && items == rhs.items && named == rhs.named &&
+               index == rhs.index && optItem == rhs.optItem && var == rhs.var &&
+               (ptr ? rhs.ptr && *ptr == *rhs.ptr : !rhs.ptr) && appender == rhs.appender;
+    }
+};
+
+Message makeMessage(int seed, size_t count)
+{
+    Message msg;
+    msg.text = std::string(100 + count, static_cast<char>('a' + seed));
+    for (size_t i = 0; i < count; i++) {
+        const auto id = static_cast<int>(i) + seed;
+        msg.samples.push_back(id * 3);
+        msg.items.push_back({id, std::string(50, 'x') + std::to_string(id)});
+        msg.named.emplace(id, std::to_string(id));
+        msg.index.emplace(std::to_string(id), Item{id, "idx"});
+    }
+    if (seed % 2)
+        msg.optItem = Item{seed, "optional item with a long name to avoid SSO"};
+    if (seed % 3)
+        msg.var = Item{seed, "variant"};
+    else
+        msg.var = seed;
+    if (seed % 2 == 0)
+        msg.ptr = std::make_unique<Item>(Item{seed, "ptr"});
+    msg.appender.values = {seed, seed + 1};
+    return msg;
+}
+
+struct Settings_v0
+{
+    int volume {};
+    using ssVersions = std::tuple<Settings_v0>;
+    auto ssTuple() const { return std::tie(volume); }
+};
+
+struct Settings_v1
+{
+    int volume {};
+    std::vector<std::string> recentFiles;
+    using ssVersions = std::tuple<Settings_v0, Settings_v1>;
+    auto ssTuple() const { return std::tie(volume, recentFiles); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Settings_v1)
+
+    void ssUpgradeFrom(const Settings_v0& prev) { volume = prev.volume; } // 'recentFiles' is expected to be empty
+    void ssDowngradeTo(Settings_v0&) const = delete;
+};
+
+} // namespace
+
+TEST(SuitableStruct, LoadInPlace_Values)
+{
+    Message msg;
+
+    for (int i = 0; i < 10; i++) {
+        const auto expected = makeMessage(i, static_cast<size_t>((i * 7) % 11));
+        ssLoadInPlace(ssSave(expected), msg);
+        ASSERT_EQ(msg, expected);
+    }
+
+    const auto expected = makeMessage(3, 4);
+    ssLoadInPlace(ssSave(expected, false), msg, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(msg, expected);
+}
+
+TEST(SuitableStruct, LoadInPlace_ReusesStorage)
+{
+    const auto saved = ssSave(makeMessage(1, 20));
+    Message msg;
+
+    // Storage of 'msg' is reused by next loads
+    ssLoadInPlace(saved, msg);
+    const auto textPtr = msg.text.data();
+    const auto samplesPtr = msg.samples.data();
+    const auto itemsPtr = msg.items.data();
+    const auto itemNamePtr = msg.items[5].name.data();
+
+    ssLoadInPlace(saved, msg);
+    ssLoadInPlace(saved, msg);
+    ASSERT_EQ(msg.text.data(), textPtr);
+    ASSERT_EQ(msg.samples.data(), samplesPtr);
+    ASSERT_EQ(msg.items.data(), itemsPtr);
+    ASSERT_EQ(msg.items[5].name.data(), itemNamePtr);
+    ASSERT_EQ(msg, makeMessage(1, 20));
+}
+
+TEST(SuitableStruct, LoadInPlace_NoRetention)
+{
+    // Previous value isn't kept anywhere: its owned objects are released by the load
+    auto owned = std::make_shared<int>(1);
+    std::vector<std::shared_ptr<int>> values {owned, owned};
+    const std::weak_ptr<int> watcher = owned;
+    owned.reset();
+
+    ssLoadInPlace(ssSave(std::vector<std::shared_ptr<int>>{std::make_shared<int>(2)}), values);
+    ASSERT_EQ(values.size(), 1u);
+    ASSERT_EQ(*values.front(), 2);
+    ASSERT_TRUE(watcher.expired());
+}
+
+TEST(SuitableStruct, LoadInPlace_StrongGuarantee)
+{
+    const auto expected = makeMessage(2, 5);
+    Message msg;
+    ssLoadInPlace(ssSave(expected), msg);
+
+    // Truncated
+    const auto saved = ssSave(makeMessage(4, 8), false);
+    for (size_t sz = 0; sz < saved.size(); sz += 7) {
+        ASSERT_ANY_THROW(ssLoadInPlace(BufferReader(saved, 0, sz), msg, SSLoadMode::NonProtectedDefault));
+        ASSERT_EQ(msg, expected);
+    }
+
+    // Corrupted
+    auto corrupted = ssSave(makeMessage(4, 8));
+    corrupted.data()[corrupted.size() - 1] ^= 1;
+    ASSERT_THROW(ssLoadInPlace(corrupted, msg), IntegrityError);
+    ASSERT_EQ(msg, expected);
+
+    // Malformed members after the ones which could be decoded already
+    size_t malformed {};
+    for (size_t pos = saved.size() / 2; pos < saved.size(); pos++) {
+        auto damaged = saved;
+        damaged.data()[pos] = 0xFF;
+
+        try {
+            (void)ssLoadRet<Message>(damaged, SSLoadMode::NonProtectedDefault);
+            continue;
+        } catch (...) { }
+
+        malformed++;
+        ASSERT_ANY_THROW(ssLoadInPlace(damaged, msg, SSLoadMode::NonProtectedDefault));
+        ASSERT_EQ(msg, expected);
+    }
+    ASSERT_GT(malformed, 0u);
+
+    ssLoadInPlace(ssSave(makeMessage(5, 3)), msg);
+    ASSERT_EQ(msg, makeMessage(5, 3));
+}
+
+TEST(SuitableStruct, LoadInPlace_Upgrade)
+{
+    Settings_v1 value {1, {"stale"}};
+    ssLoadInPlace(ssSave(value), value);
+    ssLoadInPlace(ssSave(Settings_v1{2, {"stale", "files"}}), value);
+
+    // 'value' holds "stale" data, upgrade must start from a fresh object
+    ssLoadInPlace(ssSave(Settings_v0{5}), value);
+    ASSERT_EQ(value, (Settings_v1{5, {}}));
+}
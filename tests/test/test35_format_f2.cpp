@@ -0,0 +1,110 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Hashes.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Measurement
+{
+    uint32_t sensor {};
+    std::string unit;
+    std::vector<double> samples;
+
+    auto ssTuple() const { return std::tie(sensor, unit, samples); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Measurement)
+};
+
+uint32_t crc32cBitwise(const uint8_t* data, size_t sz)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < sz; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+} // namespace
+
+TEST(SuitableStruct, FormatF2_Crc32c)
+{
+    // RFC 3720 test vectors
+    uint8_t data[32] {};
+    ASSERT_EQ(ssHashRaw_F2(data, sizeof(data)), 0x8A9136AAu);
+
+    memset(data, 0xFF, sizeof(data));
+    ASSERT_EQ(ssHashRaw_F2(data, sizeof(data)), 0x62A8AB43u);
+
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = static_cast<uint8_t>(i);
+    ASSERT_EQ(ssHashRaw_F2(data, sizeof(data)), 0x46DD794Eu);
+
+    ASSERT_EQ(ssHashRaw_F2("123456789", 9), 0xE3069283u);
+    ASSERT_EQ(ssHashRaw_F2(nullptr, 0), 0u);
+
+    // Unaligned starts and tails
+    std::vector<uint8_t> bytes(300);
+    for (size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+
+    for (size_t offset = 0; offset < 9; offset++)
+        for (size_t sz = 0; sz + offset <= bytes.size(); sz += 13)
+            ASSERT_EQ(ssHashRaw_F2(bytes.data() + offset, sz), crc32cBitwise(bytes.data() + offset, sz));
+}
+
+TEST(SuitableStruct, FormatF2_SaveLoad)
+{
+    const Measurement measurement {7, "mV", {1.0, 2.5, -3.0}};
+
+    const auto savedF1 = ssSave(measurement);
+    const auto savedF2 = ssSave(measurement, SSDataFormat::F2);
+    ASSERT_EQ(savedF1, ssSave(measurement, SSDataFormat::F1));
+    ASSERT_THROW((void)ssSave(measurement, SSDataFormat::F0), FormatError);
+
+    ASSERT_EQ(ssDetectFormat(savedF1), SSDataFormat::F1);
+    ASSERT_EQ(ssDetectFormat(savedF2), SSDataFormat::F2);
+
+    // Same envelope layout & payload, different mark & hash
+    ASSERT_EQ(savedF1.size(), savedF2.size());
+    const size_t bodyPos = sizeof(uint64_t) + sizeof(uint32_t) + Internal::SS_FORMAT_MARK_SIZE;
+    ASSERT_EQ(memcmp(savedF1.cdata() + bodyPos, savedF2.cdata() + bodyPos, savedF1.size() - bodyPos), 0);
+
+    const auto payloadPos = sizeof(uint64_t) + sizeof(uint32_t);
+    uint32_t storedHash {};
+    memcpy(&storedHash, savedF2.cdata() + sizeof(uint64_t), sizeof(storedHash));
+    ASSERT_EQ(storedHash, ssHashRaw_F2(savedF2.cdata() + payloadPos, savedF2.size() - payloadPos));
+
+    ASSERT_EQ(ssLoadRet<Measurement>(savedF2), measurement);
+
+    Buffer appended;
+    BufferWriter writer(appended);
+    ssSaveTo(writer, measurement, SSDataFormat::F2);
+    ASSERT_EQ(appended, savedF2);
+}
+
+TEST(SuitableStruct, FormatF2_Integrity)
+{
+    const Measurement measurement {7, "mV", {1.0, 2.5, -3.0}};
+    auto saved = ssSave(measurement, SSDataFormat::F2);
+    saved.data()[saved.size() - 1] ^= 1;
+
+    ASSERT_THROW((void)ssLoadRet<Measurement>(saved), IntegrityError);
+    ASSERT_FALSE(ssDetectFormat(saved).has_value());
+
+    // F1 hash doesn't make F2 data valid
+    auto savedF1Hash = ssSave(measurement, SSDataFormat::F2);
+    const auto payloadPos = sizeof(uint64_t) + sizeof(uint32_t);
+    const auto f1Hash = ssHashRaw_F1(savedF1Hash.cdata() + payloadPos, savedF1Hash.size() - payloadPos);
+    memcpy(savedF1Hash.data() + sizeof(uint64_t), &f1Hash, sizeof(f1Hash));
+    ASSERT_THROW((void)ssLoadRet<Measurement>(savedF1Hash), IntegrityError);
+}
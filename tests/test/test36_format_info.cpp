@@ -0,0 +1,136 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Hashes.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+// Item of a stream of protected saves
+struct Message
+{
+    uint32_t seq {};
+    std::string text;
+
+    auto ssTuple() const { return std::tie(seq, text); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Message)
+};
+
+constexpr size_t HeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+// Primitive payload is the same in F0 and F1, only mark & hash differ
+Buffer makeF0(int value)
+{
+    auto saved = ssSave(value);
+    memcpy(saved.data() + HeaderSize, Internal::SS_FORMAT_F0, Internal::SS_FORMAT_MARK_SIZE);
+    const auto hash = ssHashRaw_F0(saved.cdata() + HeaderSize, saved.size() - HeaderSize);
+    memcpy(saved.data() + sizeof(uint64_t), &hash, sizeof(hash));
+    return saved;
+}
+
+} // namespace
+
+TEST(SuitableStruct, FormatInfo_Detect)
+{
+    const Message message {7, "message"};
+
+    for (const auto format : {SSDataFormat::F1, SSDataFormat::F2}) {
+        const auto saved = ssSave(message, format);
+        const auto info = ssDetectFormatInfo(saved);
+        ASSERT_TRUE(info.has_value());
+        ASSERT_EQ(info->format, format);
+        ASSERT_EQ(info->payloadOffset, Internal::SS_PROTECTED_HEADER_SIZE);
+        ASSERT_EQ(info->payloadSize, saved.size() - Internal::SS_PROTECTED_HEADER_SIZE);
+        ASSERT_EQ(info->totalSize, saved.size());
+        ASSERT_EQ(ssDetectFormat(saved), format);
+
+        Message loaded;
+        ssLoad(saved, loaded, *info);
+        ASSERT_EQ(loaded, message);
+    }
+
+    const auto savedF0 = makeF0(42);
+    ASSERT_EQ(ssDetectFormat(savedF0), SSDataFormat::F0);
+    ASSERT_EQ(ssLoadRet<int>(savedF0), 42);
+
+    const auto infoF0 = ssDetectFormatInfo(savedF0);
+    ASSERT_TRUE(infoF0.has_value());
+    int value {};
+    ssLoad(savedF0, value, *infoF0);
+    ASSERT_EQ(value, 42);
+}
+
+TEST(SuitableStruct, FormatInfo_Stream)
+{
+    const Message first {1, "first"};
+    const Message second {2, "second"};
+
+    Buffer stream;
+    stream.write(static_cast<uint32_t>(0xDEADBEEF)); // Unrelated prefix
+    BufferWriter writer(stream);
+    ssSaveTo(writer, first, SSDataFormat::F2);
+    ssSaveTo(writer, second);
+
+    BufferReader reader(stream);
+    reader.advance(sizeof(uint32_t));
+
+    // Detection doesn't move reader, loading does
+    const auto info1 = ssDetectFormatInfo(reader);
+    ASSERT_TRUE(info1.has_value());
+    ASSERT_EQ(reader.position(), sizeof(uint32_t));
+    ASSERT_EQ(info1->format, SSDataFormat::F2);
+
+    Message loaded;
+    ssLoad(reader, loaded, *info1);
+    ASSERT_EQ(loaded, first);
+    ASSERT_EQ(reader.position(), sizeof(uint32_t) + info1->totalSize);
+
+    const auto info2 = ssDetectFormatInfo(reader);
+    ASSERT_TRUE(info2.has_value());
+    ASSERT_EQ(info2->format, SSDataFormat::F1);
+    ssLoad(reader, loaded, *info2);
+    ASSERT_EQ(loaded, second);
+    ASSERT_EQ(reader.rest(), 0);
+
+    ASSERT_FALSE(ssDetectFormatInfo(reader).has_value());
+}
+
+TEST(SuitableStruct, FormatInfo_Integrity)
+{
+    const Message message {7, "message"};
+
+    for (const auto format : {SSDataFormat::F1, SSDataFormat::F2}) {
+        auto saved = ssSave(message, format);
+        const auto info = ssDetectFormatInfo(saved);
+        ASSERT_TRUE(info.has_value());
+
+        // Info of other data
+        auto otherInfo = *info;
+        otherInfo.payloadSize--;
+        Message loaded;
+        ASSERT_THROW(ssLoad(saved, loaded, otherInfo), IntegrityError);
+
+        otherInfo = *info;
+        otherInfo.format = (format == SSDataFormat::F1) ? SSDataFormat::F2 : SSDataFormat::F1;
+        ASSERT_THROW(ssLoad(saved, loaded, otherInfo), IntegrityError);
+
+        // Corrupted hash is rejected by detection and protected load
+        saved.data()[sizeof(uint64_t)] ^= 1;
+        ASSERT_FALSE(ssDetectFormatInfo(saved).has_value());
+        ASSERT_THROW(ssLoad(saved, loaded), IntegrityError);
+    }
+
+    // Valid hash, unknown mark
+    auto unknownMark = ssSave(message);
+    unknownMark.data()[HeaderSize] = 0x7F;
+    const auto hash = ssHashRaw_F1(unknownMark.cdata() + HeaderSize, unknownMark.size() - HeaderSize);
+    memcpy(unknownMark.data() + sizeof(uint64_t), &hash, sizeof(hash));
+    ASSERT_FALSE(ssDetectFormat(unknownMark).has_value());
+    ASSERT_THROW(ssLoadRet<Message>(unknownMark), FormatError);
+}
@@ -0,0 +1,84 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+// Self-produced data, e.g. read back from own cache
+struct CacheEntry
+{
+    int key {};
+    std::string value;
+    std::vector<int64_t> timestamps;
+
+    auto ssTuple() const { return std::tie(key, value, timestamps); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(CacheEntry)
+};
+
+constexpr size_t HeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+} // namespace
+
+TEST(SuitableStruct, TrustedLoad_Basic)
+{
+    const CacheEntry entry {7, "cached", {100, 200, -300}};
+
+    for (const auto format : {SSDataFormat::F1, SSDataFormat::F2}) {
+        const auto saved = ssSave(entry, format);
+        ASSERT_TRUE(ssVerify(saved));
+        ASSERT_EQ(ssLoadRet<CacheEntry>(saved, SSLoadMode::ProtectedTrusted), entry);
+
+        CacheEntry inPlace;
+        ssLoadInPlace(saved, inPlace, SSLoadMode::ProtectedTrusted);
+        ASSERT_EQ(inPlace, entry);
+    }
+
+    ASSERT_EQ(ssLoadRet<int>(ssSave(42), SSLoadMode::ProtectedTrusted), 42);
+}
+
+TEST(SuitableStruct, TrustedLoad_HashNotChecked)
+{
+    const CacheEntry entry {7, "cached", {100, 200, -300}};
+    auto saved = ssSave(entry);
+    saved.data()[sizeof(uint64_t)] ^= 1;
+
+    ASSERT_FALSE(ssVerify(saved));
+    ASSERT_THROW((void)ssLoadRet<CacheEntry>(saved), IntegrityError);
+    ASSERT_EQ(ssLoadRet<CacheEntry>(saved, SSLoadMode::ProtectedTrusted), entry);
+
+    // Reader position is kept
+    BufferReader reader(saved);
+    ASSERT_FALSE(ssVerify(reader));
+    ASSERT_EQ(reader.position(), 0);
+}
+
+TEST(SuitableStruct, TrustedLoad_Malformed)
+{
+    const CacheEntry entry {7, "cached", {100, 200, -300}};
+    const auto saved = ssSave(entry);
+
+    // Size is still checked
+    auto truncated = saved;
+    truncated.reduceSize(1);
+    ASSERT_THROW((void)ssLoadRet<CacheEntry>(truncated, SSLoadMode::ProtectedTrusted), IntegrityError);
+
+    // Format mark is still checked
+    auto badMark = saved;
+    badMark.data()[HeaderSize] = 0x7F;
+    ASSERT_THROW((void)ssLoadRet<CacheEntry>(badMark, SSLoadMode::ProtectedTrusted), FormatError);
+
+    // Bounds are still checked: payload claims more items than it has
+    auto badCount = saved;
+    const uint64_t hugeSize = 1000;
+    const auto stringSizePos = HeaderSize + Internal::SS_FORMAT_MARK_SIZE + Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + sizeof(int);
+    memcpy(badCount.data() + stringSizePos, &hugeSize, sizeof(hugeSize));
+    ASSERT_THROW((void)ssLoadRet<CacheEntry>(badCount, SSLoadMode::ProtectedTrusted), std::out_of_range);
+}
@@ -0,0 +1,132 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <SuitableStruct/MappedFile.h>
+#include <SuitableStruct/ArrayView.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Snapshot
+{
+    uint64_t revision {};
+    std::string label;
+    std::vector<float> grid;
+
+    auto ssTuple() const { return std::tie(revision, label, grid); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Snapshot)
+};
+
+struct Frame
+{
+    std::string_view name;
+    ArrayView<double> samples;
+
+    auto ssTuple() const { return std::tie(name, samples); }
+};
+
+class TempFile
+{
+public:
+    explicit TempFile(const Buffer& content)
+        : m_path((std::filesystem::temp_directory_path() /
+                  ("ss_mapped_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".bin")).string())
+    {
+        std::ofstream file(m_path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.cdata()), static_cast<std::streamsize>(content.size()));
+    }
+
+    ~TempFile() { std::error_code ec; std::filesystem::remove(m_path, ec); }
+
+    const std::string& path() const { return m_path; }
+
+private:
+    std::string m_path;
+};
+
+} // namespace
+
+TEST(SuitableStruct, MappedFile_RawReader)
+{
+    const uint8_t data[] = {1, 0, 0, 0, 2, 0, 0, 0, 3};
+    BufferReader reader(data, sizeof(data), 4);
+    ASSERT_FALSE(reader.hasBufferSrc());
+    ASSERT_EQ(reader.size(), 5);
+    ASSERT_EQ(reader.read<uint32_t>(), 2u);
+
+    auto sub = reader.readRaw(1);
+    ASSERT_EQ(sub.read<uint8_t>(), 3);
+    ASSERT_THROW(sub.read<uint8_t>(), std::out_of_range);
+    ASSERT_THROW(reader.read<uint8_t>(), std::out_of_range);
+    ASSERT_EQ(reader.bufferMapped(), Buffer(data + 4, 5));
+
+    const Snapshot snapshot {7, "snapshot", {1.0f, 2.5f}};
+    const auto saved = ssSave(snapshot);
+    BufferReader savedReader(saved.cdata(), saved.size());
+    ASSERT_TRUE(ssDetectFormatInfo(savedReader).has_value());
+    ASSERT_EQ(ssLoadRet<Snapshot>(savedReader), snapshot);
+}
+
+TEST(SuitableStruct, MappedFile_Load)
+{
+    const Snapshot snapshot {7, "snapshot", std::vector<float>(1000, 1.5f)};
+    const TempFile file(ssSave(snapshot, SSDataFormat::F2));
+
+    ASSERT_EQ(ssLoadMappedRet<Snapshot>(file.path()), snapshot);
+
+    MappedFile mapped(file.path());
+    ASSERT_TRUE(mapped.isOpen());
+    ASSERT_EQ(mapped.size(), ssSerializedSize(snapshot));
+
+    auto moved = std::move(mapped);
+    ASSERT_FALSE(mapped.isOpen());
+    ASSERT_EQ(ssLoadRet<Snapshot>(moved.reader()), snapshot);
+
+    moved.close();
+    ASSERT_FALSE(moved.isOpen());
+}
+
+TEST(SuitableStruct, MappedFile_Views)
+{
+    const std::string name = "frame";
+    const std::vector<double> samples(1000, 2.5);
+    const TempFile file(ssSave(Frame{name, samples}, SSDataFormat::F2));
+
+    auto mapped = ssLoadMappedWithFile<Frame>(file.path());
+    const auto loaded = std::move(mapped);
+    const auto begin = loaded.file.data();
+    const auto end = begin + loaded.file.size();
+
+    ASSERT_EQ(loaded.value.name, name);
+    ASSERT_EQ(loaded.value.samples, ArrayView<double>(samples));
+    ASSERT_FALSE(loaded.value.samples.isOwning());
+    ASSERT_TRUE(reinterpret_cast<const uint8_t*>(loaded.value.name.data()) >= begin &&
+                reinterpret_cast<const uint8_t*>(loaded.value.name.data()) < end);
+    ASSERT_TRUE(reinterpret_cast<const uint8_t*>(loaded.value.samples.data()) >= begin &&
+                reinterpret_cast<const uint8_t*>(loaded.value.samples.data()) < end);
+}
+
+TEST(SuitableStruct, MappedFile_Errors)
+{
+    ASSERT_THROW(MappedFile("/nonexistent/ss_mapped_file.bin"), std::system_error);
+
+    const TempFile empty {Buffer()};
+    MappedFile mapped(empty.path());
+    ASSERT_TRUE(mapped.isOpen());
+    ASSERT_EQ(mapped.size(), 0);
+    ASSERT_THROW((void)ssLoadRet<Snapshot>(mapped.reader()), IntegrityError);
+
+    auto truncated = ssSave(Snapshot{1, "truncated", {}});
+    truncated.reduceSize(1);
+    const TempFile truncatedFile(truncated);
+    ASSERT_THROW((void)ssLoadMappedRet<Snapshot>(truncatedFile.path()), IntegrityError);
+}
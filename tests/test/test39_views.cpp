@@ -0,0 +1,137 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/ArrayView.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Owning
+{
+    int id {};
+    std::string name;
+    std::vector<double> values;
+    std::vector<int32_t> ids;
+
+    auto ssTuple() const { return std::tie(id, name, values, ids); }
+};
+
+struct Viewing
+{
+    int id {};
+    std::string_view name;
+    ArrayView<double> values;
+    ArrayView<int32_t> ids;
+
+    auto ssTuple() const { return std::tie(id, name, values, ids); }
+};
+
+bool isInside(const void* ptr, const Buffer& buffer)
+{
+    const auto p = static_cast<const uint8_t*>(ptr);
+    return p >= buffer.cdata() && p < buffer.cdata() + buffer.size();
+}
+
+} // namespace
+
+TEST(SuitableStruct, Views_StringView)
+{
+    const std::string str = "Hello, views!";
+    const auto saved = ssSave(std::string_view(str));
+    ASSERT_EQ(saved, ssSave(str));
+    ASSERT_EQ(ssSerializedSize(std::string_view(str)), saved.size());
+
+    std::string_view view;
+    ssLoad(saved, view);
+    ASSERT_EQ(view, str);
+    ASSERT_TRUE(isInside(view.data(), saved));
+
+    ASSERT_EQ(ssLoadRet<std::string>(saved), str);
+}
+
+TEST(SuitableStruct, Views_ArrayView)
+{
+    Owning owning {5, "name", {1.5, 2.5, 3.5}, {1, 2, 3, 4}};
+
+    // Saved in any byte position
+    for (size_t prefix = 0; prefix < 8; prefix++) {
+        Viewing source {owning.id, owning.name, owning.values, owning.ids};
+
+        Buffer buffer;
+        buffer.writeZeros(prefix);
+        BufferWriter writer(buffer);
+        ssSaveTo(writer, source);
+        ASSERT_EQ(buffer.size() - prefix, ssSerializedSize(source));
+
+        BufferReader reader(buffer, prefix);
+        Viewing loaded;
+        ssLoad(reader, loaded);
+
+        ASSERT_EQ(loaded.id, owning.id);
+        ASSERT_EQ(loaded.name, owning.name);
+        ASSERT_TRUE(std::equal(loaded.values.begin(), loaded.values.end(), owning.values.begin(), owning.values.end()));
+        ASSERT_TRUE(std::equal(loaded.ids.begin(), loaded.ids.end(), owning.ids.begin(), owning.ids.end()));
+
+        // Items are aligned in the destination buffer, so they are viewed in place
+        if (reinterpret_cast<uintptr_t>(buffer.cdata()) % alignof(double) == 0) {
+            ASSERT_FALSE(loaded.values.isOwning());
+            ASSERT_FALSE(loaded.ids.isOwning());
+            ASSERT_TRUE(isInside(loaded.values.data(), buffer));
+            ASSERT_TRUE(isInside(loaded.ids.data(), buffer));
+        }
+    }
+}
+
+TEST(SuitableStruct, Views_Misaligned)
+{
+    const std::vector<double> values {1.0, 2.0, 3.0};
+    const auto saved = ssSave(ArrayView<double>(values), false);
+
+    // Shift data by one byte, so items can't be viewed in place
+    std::vector<uint8_t> storage(saved.size() + 16);
+    auto ptr = storage.data();
+    while (reinterpret_cast<uintptr_t>(ptr) % alignof(double) != 1)
+        ptr++;
+    memcpy(ptr, saved.cdata(), saved.size());
+
+    ArrayView<double> loaded;
+    ssLoad(BufferReader(ptr, saved.size()), loaded, SSLoadMode::NonProtectedDefault);
+    ASSERT_TRUE(loaded.isOwning());
+    ASSERT_EQ(loaded, ArrayView<double>(values));
+
+    // Copy keeps owned storage alive
+    const auto copy = loaded;
+    loaded = {};
+    ASSERT_EQ(copy, ArrayView<double>(values));
+}
+
+TEST(SuitableStruct, Views_Corrupted)
+{
+    Buffer buffer;
+    buffer.write(static_cast<uint64_t>(1000));
+    buffer.write(static_cast<uint8_t>(0));
+    buffer.writeZeros(16);
+
+    BufferReader reader(buffer);
+    ArrayView<uint8_t> bytes;
+    ASSERT_THROW(ssLoadImpl(reader, bytes), std::out_of_range);
+
+    reader.resetPosition();
+    std::string_view view;
+    ASSERT_THROW(ssLoadImpl(reader, view), std::out_of_range);
+
+    // Padding can't exceed alignment
+    Buffer badPadding;
+    badPadding.write(static_cast<uint64_t>(0));
+    badPadding.write(static_cast<uint8_t>(alignof(int32_t)));
+    badPadding.writeZeros(16);
+    BufferReader badPaddingReader(badPadding);
+    ArrayView<int32_t> ints;
+    ASSERT_THROW(ssLoadImpl(badPaddingReader, ints), FormatError);
+}
@@ -0,0 +1,124 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/View.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/map.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+enum class Priority : uint8_t { Low, High };
+
+struct Route
+{
+    std::string destination;
+    uint16_t port {};
+
+    auto ssTuple() const { return std::tie(destination, port); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Route)
+};
+
+struct Message
+{
+    int id {};
+    std::vector<std::string> payload;
+    std::map<int, std::string> attributes;
+    Route route;
+    Priority priority {};
+
+    auto ssTuple() const { return std::tie(id, payload, attributes, route, priority); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Message)
+};
+
+Message makeMessage()
+{
+    Message msg;
+    msg.id = 17;
+    msg.payload.assign(100, std::string(400, 'p'));
+    msg.attributes = {{1, "one"}, {2, "two"}};
+    msg.route = {"backend-7", 8080};
+    msg.priority = Priority::High;
+    return msg;
+}
+
+struct Contact_v0
+{
+    std::string name;
+    using ssVersions = std::tuple<Contact_v0>;
+    auto ssTuple() const { return std::tie(name); }
+};
+
+struct Contact_v1
+{
+    std::string name;
+    std::string email;
+    using ssVersions = std::tuple<Contact_v0, Contact_v1>;
+    auto ssTuple() const { return std::tie(name, email); }
+
+    void ssUpgradeFrom(const Contact_v0& prev) { name = prev.name; }
+    void ssDowngradeTo(Contact_v0& next) const { next.name = name; }
+};
+
+} // namespace
+
+TEST(SuitableStruct, View_Members)
+{
+    const auto msg = makeMessage();
+
+    for (const auto format : {SSDataFormat::F1, SSDataFormat::F2}) {
+        const auto saved = ssSave(msg, format);
+        const auto view = ssView<Message>(saved);
+
+        ASSERT_EQ(view.get<0>(), msg.id);
+        ASSERT_EQ(view.get<1>(), msg.payload);
+        ASSERT_EQ(view.get<2>(), msg.attributes);
+        ASSERT_EQ(view.get<3>(), msg.route);
+        ASSERT_EQ(view.get<4>(), msg.priority);
+        ASSERT_EQ(view.field<3>().get<0>(), msg.route.destination);
+        ASSERT_EQ(view.field<3>().get<1>(), msg.route.port);
+        ASSERT_EQ(view.load(), msg);
+    }
+
+    const auto savedRaw = ssSave(msg, false);
+    const auto rawView = ssView<Message>(savedRaw, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(rawView.field<3>().get<0>(), msg.route.destination);
+}
+
+TEST(SuitableStruct, View_SkipsWithoutDecoding)
+{
+    const auto msg = makeMessage();
+    auto saved = ssSave(msg, false);
+
+    // Damage the contents of 'payload' strings, keeping framing intact
+    const auto damagePos = saved.size() / 2;
+    saved.data()[damagePos] = 0xFF;
+    saved.data()[damagePos + 1] = 0xFF;
+
+    const auto view = ssView<Message>(saved, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(view.get<3>(), msg.route);
+    ASSERT_EQ(view.get<4>(), msg.priority);
+}
+
+TEST(SuitableStruct, View_Versions)
+{
+    // Older reader picks its own segment of newer data
+    const auto saved = ssSave(Contact_v1{"name", "name@example.com"});
+    ASSERT_EQ(ssView<Contact_v0>(saved).get<0>(), "name");
+    ASSERT_EQ(ssView<Contact_v1>(saved).get<1>(), "name@example.com");
+
+    // No upgrade for views
+    const auto savedOld = ssSave(Contact_v0{"name"});
+    ASSERT_THROW((void)ssView<Contact_v1>(savedOld), VersionError);
+
+    // Protected mode checks integrity
+    auto corrupted = ssSave(makeMessage());
+    corrupted.data()[corrupted.size() - 1] ^= 1;
+    ASSERT_THROW((void)ssView<Message>(corrupted), IntegrityError);
+    ASSERT_EQ(ssView<Message>(corrupted, SSLoadMode::ProtectedTrusted).get<0>(), 17);
+}
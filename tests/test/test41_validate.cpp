@@ -0,0 +1,181 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/ArrayView.h>
+#include <SuitableStruct/Containers/array.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/map.h>
+#include <SuitableStruct/Containers/set.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+enum class Kind : uint8_t { A, B };
+
+struct Inner
+{
+    std::string name;
+    std::optional<int> opt;
+
+    auto ssTuple() const { return std::tie(name, opt); }
+};
+
+struct Custom
+{
+    int value {};
+
+    Buffer ssSaveImpl() const { return Buffer::fromValue(value); }
+    void ssLoadImpl(BufferReader& src) { src.read(value); }
+};
+
+struct Request
+{
+    int id {};
+    Kind kind {};
+    std::string text;
+    std::vector<Inner> inners;
+    std::map<std::string, std::vector<int>> named;
+    std::set<int> ints;
+    std::array<uint16_t, 3> arr {};
+    std::variant<int, std::string, Inner> var;
+    std::unique_ptr<Inner> ptr;
+    std::shared_ptr<std::string> shared;
+    std::pair<int, std::string> pair;
+    std::tuple<double, std::string> tuple;
+    std::chrono::milliseconds duration {};
+    std::chrono::system_clock::time_point tp;
+    Custom custom;
+    std::vector<double> doubles;
+
+    auto ssTuple() const { return std::tie(id, kind, text, inners, named, ints, arr, var, ptr, shared, pair, tuple, duration, tp, custom, doubles); }
+};
+
+Request makeRequest()
+{
+    Request r;
+    r.id = 5;
+    r.kind = Kind::B;
+    r.text = "text";
+    r.inners = {{"a", 1}, {"b", {}}};
+    r.named = {{"x", {1, 2}}, {"y", {}}};
+    r.ints = {3, 4};
+    r.arr = {1, 2, 3};
+    r.var = Inner{"variant", 7};
+    r.ptr = std::make_unique<Inner>(Inner{"ptr", {}});
+    r.shared = std::make_shared<std::string>("shared");
+    r.pair = {1, "pair"};
+    r.tuple = {1.5, "tuple"};
+    r.duration = std::chrono::milliseconds(100);
+    r.tp = std::chrono::system_clock::now();
+    r.custom.value = 9;
+    r.doubles = {1.0, 2.0};
+    return r;
+}
+
+// Newer data has no segment for older readers
+struct Query_v0
+{
+    std::string text;
+    using ssVersions = std::tuple<Query_v0>;
+    auto ssTuple() const { return std::tie(text); }
+};
+
+struct Query_v1
+{
+    std::string text;
+    std::vector<int> filters;
+    using ssVersions = std::tuple<Query_v0, Query_v1>;
+    auto ssTuple() const { return std::tie(text, filters); }
+
+    void ssUpgradeFrom(const Query_v0& prev) { text = prev.text; }
+    void ssDowngradeTo(Query_v0&) const = delete;
+};
+
+} // namespace
+
+TEST(SuitableStruct, Validate_Valid)
+{
+    const auto request = makeRequest();
+
+    ASSERT_TRUE(ssValidate<Request>(ssSave(request)));
+    ASSERT_TRUE(ssValidate<Request>(ssSave(request, SSDataFormat::F2)));
+    ASSERT_TRUE(ssValidate<Request>(ssSave(request, false), SSLoadMode::NonProtectedDefault));
+    ASSERT_TRUE(ssValidate<Request>(ssSave(Request())));
+    ASSERT_TRUE(ssValidate<int>(ssSave(42)));
+    ASSERT_TRUE(ssValidate<std::string>(ssSave(std::string("str"))));
+
+    const std::vector<int32_t> ints {1, 2, 3};
+    ASSERT_TRUE(ssValidate<ArrayView<int32_t>>(ssSave(ArrayView<int32_t>(ints))));
+
+    // Older data is validated with older type
+    ASSERT_TRUE(ssValidate<Query_v1>(ssSave(Query_v0{"old"})));
+    ASSERT_FALSE(ssValidate<Query_v0>(ssSave(Query_v1{"new", {1}})));
+}
+
+TEST(SuitableStruct, Validate_Malformed)
+{
+    const auto saved = ssSave(makeRequest(), false);
+
+    // Every truncation is detected and doesn't read out of range
+    for (size_t sz = 0; sz < saved.size(); sz++) {
+        BufferReader reader(saved, 0, sz);
+        ASSERT_FALSE(ssValidate<Request>(reader, SSLoadMode::NonProtectedDefault)) << sz;
+        ASSERT_EQ(reader.position(), 0);
+    }
+
+    // Single corrupted byte is either detected or harmless for loading
+    for (size_t pos = 0; pos < saved.size(); pos++) {
+        auto corrupted = saved;
+        corrupted.data()[pos] ^= 0xA5;
+
+        if (!ssValidate<Request>(corrupted, SSLoadMode::NonProtectedDefault))
+            continue;
+
+        Request loaded;
+        ASSERT_NO_THROW(ssLoad(corrupted, loaded, SSLoadMode::NonProtectedDefault)) << pos;
+    }
+
+    // Hash is checked in protected mode
+    auto protectedData = ssSave(makeRequest());
+    protectedData.data()[protectedData.size() - 1] ^= 1;
+    ASSERT_FALSE(ssValidate<Request>(protectedData));
+    ASSERT_TRUE(ssValidate<Request>(protectedData, SSLoadMode::ProtectedTrusted));
+}
+
+TEST(SuitableStruct, Validate_Variant)
+{
+    auto saved = ssSave(std::variant<int, std::string>(5), false);
+
+    // Segments count, version, segment size, index
+    const size_t indexPos = sizeof(uint8_t) * 2 + sizeof(uint64_t);
+    saved.data()[indexPos] = 2;
+    ASSERT_FALSE((ssValidate<std::variant<int, std::string>>(saved, SSLoadMode::NonProtectedDefault)));
+    ASSERT_THROW((ssLoadRet<std::variant<int, std::string>>(saved, SSLoadMode::NonProtectedDefault)), FormatError);
+}
+
+TEST(SuitableStruct, Skip)
+{
+    const auto request = makeRequest();
+
+    Buffer stream;
+    BufferWriter writer(stream);
+    ssSaveTo(writer, request, false);
+    ssSaveTo(writer, 42, false);
+    ssSaveTo(writer, request);
+    ssSaveTo(writer, std::string("tail"));
+
+    BufferReader reader(stream);
+    ssSkip<Request>(reader, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(reader.position(), ssSerializedSize(request, false));
+    ASSERT_EQ(ssLoadRet<int>(reader, SSLoadMode::NonProtectedDefault), 42);
+    ssSkip<Request>(reader);
+    ASSERT_EQ(ssLoadRet<std::string>(reader), "tail");
+
+    BufferReader truncated(stream, 0, 20);
+    ASSERT_THROW(ssSkip<Request>(truncated, SSLoadMode::NonProtectedDefault), std::out_of_range);
+}
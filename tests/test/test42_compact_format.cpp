@@ -0,0 +1,348 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/ArrayView.h>
+#include <SuitableStruct/View.h>
+#include <SuitableStruct/Containers/array.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/map.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+enum class Kind : uint32_t { A, B = 1000 };
+
+struct Point
+{
+    int x {};
+    int y {};
+
+    auto ssTuple() const { return std::tie(x, y); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Point)
+};
+
+struct Record
+{
+    int64_t id {};
+    uint16_t port {};
+    int8_t small {};
+    bool flag {};
+    double ratio {};
+    Kind kind {};
+    std::string name;
+    std::vector<int> values;
+    std::vector<Point> points;
+    std::map<std::string, uint32_t> counters;
+    std::array<int16_t, 3> triple {};
+    std::optional<Point> optPoint;
+    std::variant<int, std::string> var;
+    std::chrono::milliseconds duration {};
+
+    auto ssTuple() const { return std::tie(id, port, small, flag, ratio, kind, name, values, points, counters, triple, optPoint, var, duration); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Record)
+};
+
+// Views nested in segments longer than one-byte varint
+struct Samples
+{
+    std::string title;
+    ArrayView<double> values;
+
+    auto ssTuple() const { return std::tie(title, values); }
+};
+
+struct Frame
+{
+    int id {};
+    Samples samples;
+
+    auto ssTuple() const { return std::tie(id, samples); }
+};
+
+struct Endpoint_v0
+{
+    uint16_t port {};
+    using ssVersions = std::tuple<Endpoint_v0>;
+    auto ssTuple() const { return std::tie(port); }
+};
+
+struct Endpoint_v1
+{
+    uint16_t port {};
+    std::string host;
+    using ssVersions = std::tuple<Endpoint_v0, Endpoint_v1>;
+    auto ssTuple() const { return std::tie(port, host); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Endpoint_v1)
+
+    void ssUpgradeFrom(const Endpoint_v0& prev) { port = prev.port; }
+    void ssDowngradeTo(Endpoint_v0& next) const { next.port = port; }
+};
+
+// Custom saver without size, counts payloads made
+struct Stamp
+{
+    static inline std::atomic<int> saves {0};
+    uint32_t value {};
+
+    Buffer ssSaveImpl() const { saves++; return Buffer::fromValue(value); }
+    void ssLoadImpl(BufferReader& src) { src.read(value); }
+    bool operator==(const Stamp& rhs) const { return value == rhs.value; }
+};
+
+struct Leaf
+{
+    std::string name;
+    Stamp stamp;
+
+    auto ssTuple() const { return std::tie(name, stamp); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Leaf)
+};
+
+struct Branch
+{
+    int id {};
+    Leaf leaf;
+    std::vector<Leaf> leaves;
+
+    auto ssTuple() const { return std::tie(id, leaf, leaves); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Branch)
+};
+
+struct Tree
+{
+    Branch branch;
+    std::optional<Branch> extra;
+
+    auto ssTuple() const { return std::tie(branch, extra); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Tree)
+};
+
+Record makeRecord()
+{
+    Record record;
+    record.id = -5;
+    record.port = 8080;
+    record.small = -3;
+    record.flag = true;
+    record.ratio = 0.25;
+    record.kind = Kind::B;
+    record.name = "record";
+    for (int i = 0; i < 100; i++)
+        record.values.push_back(i - 50);
+    record.points = {{1, 2}, {-300, 70000}};
+    record.counters = {{"a", 1}, {"b", 200}};
+    record.triple = {-1, 0, 1};
+    record.optPoint = Point{3, 4};
+    record.var = std::string("variant");
+    record.duration = std::chrono::milliseconds(1500);
+    return record;
+}
+
+template<typename T>
+T roundTrip(const T& value)
+{
+    const auto saved = ssSave(value, SSDataFormat::F3);
+    EXPECT_EQ(saved.size(), ssSerializedSize(value, SSDataFormat::F3));
+    return ssLoadRet<T>(saved);
+}
+
+} // namespace
+
+TEST(SuitableStruct, CompactFormat_SaveLoad)
+{
+    const auto record = makeRecord();
+    const auto saved = ssSave(record, SSDataFormat::F3);
+    ASSERT_EQ(ssDetectFormat(saved), SSDataFormat::F3);
+    ASSERT_EQ(ssLoadRet<Record>(saved), record);
+    ASSERT_EQ(saved.size(), ssSerializedSize(record, SSDataFormat::F3));
+    ASSERT_LT(saved.size() * 2, ssSave(record, SSDataFormat::F1).size());
+
+    ASSERT_EQ(roundTrip(Record()), Record());
+    ASSERT_EQ(roundTrip(std::vector<Record>{record, Record(), record}), (std::vector<Record>{record, Record(), record}));
+    ASSERT_EQ(roundTrip(std::string(1000, 'x')), std::string(1000, 'x'));
+
+    // Segments larger than one varint byte
+    std::vector<Point> points(500);
+    for (size_t i = 0; i < points.size(); i++)
+        points[i] = {static_cast<int>(i), -static_cast<int>(i) * 1000};
+    ASSERT_EQ(roundTrip(points), points);
+
+    const Endpoint_v1 endpoint {8080, "localhost"};
+    ASSERT_EQ(roundTrip(endpoint), endpoint);
+    ASSERT_EQ(ssLoadRet<Endpoint_v1>(ssSave(Endpoint_v0{443}, SSDataFormat::F3)), (Endpoint_v1{443, {}}));
+
+    // Same envelope & hash as F2, different payload
+    const auto payloadPos = sizeof(uint64_t) + sizeof(uint32_t);
+    uint32_t storedHash {};
+    memcpy(&storedHash, saved.cdata() + sizeof(uint64_t), sizeof(storedHash));
+    ASSERT_EQ(storedHash, ssHashRaw_F2(saved.cdata() + payloadPos, saved.size() - payloadPos));
+
+    Buffer appended;
+    BufferWriter writer(appended);
+    ssSaveTo(writer, record, SSDataFormat::F3);
+    ASSERT_EQ(appended, saved);
+}
+
+TEST(SuitableStruct, CompactFormat_IntegerLimits)
+{
+    ASSERT_EQ(roundTrip(std::numeric_limits<int64_t>::min()), std::numeric_limits<int64_t>::min());
+    ASSERT_EQ(roundTrip(std::numeric_limits<int64_t>::max()), std::numeric_limits<int64_t>::max());
+    ASSERT_EQ(roundTrip(std::numeric_limits<uint64_t>::max()), std::numeric_limits<uint64_t>::max());
+    ASSERT_EQ(roundTrip(std::numeric_limits<int32_t>::min()), std::numeric_limits<int32_t>::min());
+    ASSERT_EQ(roundTrip(std::numeric_limits<int16_t>::min()), std::numeric_limits<int16_t>::min());
+    ASSERT_EQ(roundTrip(std::numeric_limits<uint16_t>::max()), std::numeric_limits<uint16_t>::max());
+
+    // Varint sizes: zigzag keeps small negative numbers short
+    const auto payloadSize = [](auto value) { return ssSerializedSize(value, SSDataFormat::F3) - Internal::SS_PROTECTED_HEADER_SIZE; };
+    ASSERT_EQ(payloadSize(0), 1u);
+    ASSERT_EQ(payloadSize(-1), 1u);
+    ASSERT_EQ(payloadSize(63), 1u);
+    ASSERT_EQ(payloadSize(64), 2u);
+    ASSERT_EQ(payloadSize(-64), 1u);
+    ASSERT_EQ(payloadSize(uint32_t(127)), 1u);
+    ASSERT_EQ(payloadSize(uint32_t(128)), 2u);
+    ASSERT_EQ(payloadSize(std::numeric_limits<uint64_t>::max()), 10u);
+    ASSERT_EQ(payloadSize(uint8_t(200)), 1u); // Single-byte types stay raw
+    ASSERT_EQ(payloadSize(1.0), sizeof(double));
+
+    std::vector<int> ints;
+    for (int i = -100000; i <= 100000; i += 77)
+        ints.push_back(i);
+    ASSERT_EQ(roundTrip(ints), ints);
+
+    const std::array<int64_t, 4> arr {std::numeric_limits<int64_t>::min(), -1, 0, std::numeric_limits<int64_t>::max()};
+    ASSERT_EQ(roundTrip(arr), arr);
+}
+
+TEST(SuitableStruct, CompactFormat_ViewsAndValidation)
+{
+    const auto record = makeRecord();
+    const auto saved = ssSave(record, SSDataFormat::F3);
+
+    ASSERT_TRUE(ssValidate<Record>(saved));
+    ASSERT_TRUE(ssVerify(saved));
+
+    BufferReader reader(saved);
+    ssSkip<Record>(reader);
+    ASSERT_EQ(reader.rest(), 0u);
+
+    const auto view = ssView<Record>(saved);
+    ASSERT_EQ(view.get<0>(), record.id);
+    ASSERT_EQ(view.get<7>(), record.values);
+    ASSERT_EQ(view.get<13>(), record.duration);
+    ASSERT_EQ(view.get<11>(), record.optPoint);
+    ASSERT_EQ(view.load(), record);
+
+    const std::vector<uint32_t> items {1, 2, 3, 1000000};
+    const auto savedItems = ssSave(ArrayView<uint32_t>(items), SSDataFormat::F3);
+    const auto loadedView = ssLoadRet<ArrayView<uint32_t>>(savedItems);
+    ASSERT_EQ(std::vector<uint32_t>(loadedView.begin(), loadedView.end()), items);
+
+    const std::vector<double> samples(100, 0.5);
+    const Frame frame {1, {std::string(200, 't'), samples}};
+    const auto savedFrame = ssSave(frame, SSDataFormat::F3);
+    ASSERT_EQ(savedFrame.size(), ssSerializedSize(frame, SSDataFormat::F3));
+    const auto loadedFrame = ssLoadRet<Frame>(savedFrame);
+    ASSERT_EQ(loadedFrame.samples.title, frame.samples.title);
+    ASSERT_EQ(loadedFrame.samples.values, ArrayView<double>(samples));
+    ASSERT_FALSE(loadedFrame.samples.values.isOwning());
+
+    auto corrupted = saved;
+    corrupted.data()[corrupted.size() - 1] ^= 1;
+    ASSERT_FALSE(ssValidate<Record>(corrupted));
+    ASSERT_THROW((void)ssLoadRet<Record>(corrupted), IntegrityError);
+}
+
+TEST(SuitableStruct, CompactFormat_Malformed)
+{
+    Internal::CompactFormatScope compactScope(true);
+
+    // Truncated varint
+    Buffer truncated;
+    truncated.write(static_cast<uint8_t>(0x80));
+    BufferReader truncatedReader(truncated);
+    ASSERT_THROW((void)truncatedReader.readVarint(), std::out_of_range);
+
+    // Varint longer than 10 bytes / overflowing 64 bits
+    Buffer overlong;
+    for (int i = 0; i < 10; i++)
+        overlong.write(static_cast<uint8_t>(0xFF));
+    overlong.write(static_cast<uint8_t>(0x01));
+    BufferReader overlongReader(overlong);
+    ASSERT_THROW((void)overlongReader.readVarint(), FormatError);
+
+    // Value doesn't fit into the target type
+    Buffer wide;
+    BufferWriter(wide).writeVarint(70000);
+    BufferReader wideReader(wide);
+    uint16_t narrow {};
+    ASSERT_THROW(ssLoadImpl(wideReader, narrow), FormatError);
+
+    // Huge container length
+    Buffer hugeCount;
+    BufferWriter(hugeCount).writeVarint(std::numeric_limits<uint64_t>::max());
+    std::vector<int> ints;
+    ASSERT_THROW(ssLoad(hugeCount, ints, SSLoadMode::NonProtectedDefault), std::out_of_range);
+
+    // More items than std::array can hold
+    std::array<int, 2> arr {};
+    const auto saved = ssSave(std::array<int, 3>{1, 2, 3}, SSDataFormat::F3);
+    ASSERT_THROW(ssLoad(saved, arr), std::out_of_range);
+}
+
+TEST(SuitableStruct, CompactFormat_NestedSizes)
+{
+    const Branch branch {1, {"leaf", {1}}, {{"a", {2}}, {std::string(200, 'b'), {3}}}};
+    const Tree tree {branch, branch};
+    constexpr int stamps = 6;
+
+    // Each custom payload is made once, not once per enclosing segment
+    Stamp::saves = 0;
+    const auto saved = ssSave(tree, SSDataFormat::F3);
+    ASSERT_EQ(Stamp::saves, stamps);
+    ASSERT_EQ(ssLoadRet<Tree>(saved), tree);
+
+    Stamp::saves = 0;
+    ASSERT_EQ(ssSerializedSize(tree, SSDataFormat::F3), saved.size());
+    ASSERT_EQ(Stamp::saves, stamps);
+
+    // Items saved by chunks on other threads
+    const std::vector<Tree> trees(50, tree);
+    const auto sequential = ssSave(trees, SSDataFormat::F3);
+
+    Stamp::saves = 0;
+    const auto parallel = ssSave(trees, SSParallelSave{4, 8}, SSDataFormat::F3);
+    ASSERT_EQ(Stamp::saves, 50 * stamps);
+    ASSERT_EQ(parallel, sequential);
+    ASSERT_EQ(ssLoadRet<std::vector<Tree>>(parallel), trees);
+
+    // Same inside of a struct, measured by the outermost segment
+    const Frame frame {7, {"samples", {}}};
+    const std::pair<Frame, std::vector<Tree>> pair {frame, trees};
+    Stamp::saves = 0;
+    const auto pairSaved = ssSave(pair, SSParallelSave{4, 8}, SSDataFormat::F3);
+    ASSERT_EQ(Stamp::saves, 50 * stamps);
+    ASSERT_EQ(pairSaved, ssSave(pair, SSDataFormat::F3));
+    ASSERT_EQ(pairSaved.size(), ssSerializedSize(pair, SSDataFormat::F3));
+    ASSERT_EQ((ssLoadRet<std::pair<Frame, std::vector<Tree>>>(pairSaved).second), trees);
+
+    // Nested containers of chunks are saved sequentially
+    const std::pair<int, std::vector<std::vector<Tree>>> nested {3, std::vector<std::vector<Tree>>(10, trees)};
+    Stamp::saves = 0;
+    const auto nestedSaved = ssSave(nested, SSParallelSave{4, 8}, SSDataFormat::F3);
+    ASSERT_EQ(Stamp::saves, 500 * stamps);
+    ASSERT_EQ(nestedSaved, ssSave(nested, SSDataFormat::F3));
+
+    // Chained save falls back to sequential one, as measured
+    Internal::ParallelSaveScope parallelScope(SSParallelSave{4, 8});
+    Stamp::saves = 0;
+    ASSERT_EQ(ssSaveChain(pair, SSDataFormat::F3).toBuffer(), pairSaved);
+    ASSERT_EQ(Stamp::saves, 50 * stamps);
+}
@@ -0,0 +1,193 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/array.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/list.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Sample
+{
+    int64_t time {};
+    double value {};
+
+    auto ssTuple() const { return std::tie(time, value); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Sample)
+};
+
+// Same as 'Sample', but with per-item framing
+struct PlainSample
+{
+    int64_t time {};
+    double value {};
+
+    auto ssTuple() const { return std::tie(time, value); }
+};
+
+struct Event
+{
+    std::string name;
+    std::vector<int> tags;
+
+    auto ssTuple() const { return std::tie(name, tags); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Event)
+};
+
+// Rows of a table, one hoisted column per version
+struct Row_v0
+{
+    int id {};
+    using ssVersions = std::tuple<Row_v0>;
+    auto ssTuple() const { return std::tie(id); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Row_v0)
+};
+
+struct Row_v1
+{
+    int id {};
+    std::string label;
+    using ssVersions = std::tuple<Row_v0, Row_v1>;
+    auto ssTuple() const { return std::tie(id, label); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Row_v1)
+
+    void ssUpgradeFrom(const Row_v0& prev) { id = prev.id; label = "upgraded"; }
+    void ssDowngradeTo(Row_v0& next) const { next.id = id; }
+};
+
+struct Hooked
+{
+    int value {};
+    mutable int saves {};
+    int loads {};
+
+    auto ssTuple() const { return std::tie(value); }
+    void ssBeforeSaveImpl() const { saves++; }
+    void ssAfterLoadImpl() { loads++; }
+};
+
+} // namespace
+
+template<> struct SuitableStruct::SSHoistFraming<Sample> : public std::true_type { };
+template<> struct SuitableStruct::SSHoistFraming<Event> : public std::true_type { };
+template<> struct SuitableStruct::SSHoistFraming<Row_v0> : public std::true_type { };
+template<> struct SuitableStruct::SSHoistFraming<Row_v1> : public std::true_type { };
+template<> struct SuitableStruct::SSHoistFraming<Hooked> : public std::true_type { };
+
+TEST(SuitableStruct, HoistedFraming_SaveLoad)
+{
+    std::vector<Sample> samples(1000);
+    std::vector<PlainSample> plainSamples(samples.size());
+    for (size_t i = 0; i < samples.size(); i++) {
+        samples[i] = {static_cast<int64_t>(i) * 1000, static_cast<double>(i) / 3};
+        plainSamples[i] = {samples[i].time, samples[i].value};
+    }
+
+    const auto saved = ssSave(samples);
+    ASSERT_EQ(ssLoadRet<std::vector<Sample>>(saved), samples);
+    ASSERT_EQ(saved.size(), ssSerializedSize(samples));
+
+    // Container framing, items count, then a single segment: count, version, size, payloads
+    const auto payloadSize = samples.size() * (sizeof(int64_t) + sizeof(double));
+    ASSERT_EQ(ssSerializedSize(samples, false), 2 * Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + sizeof(uint64_t) + payloadSize);
+    ASSERT_EQ(ssSerializedSize(plainSamples, false), Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + sizeof(uint64_t) +
+                                                     samples.size() * Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + payloadSize);
+
+    const auto savedF3 = ssSave(samples, SSDataFormat::F3);
+    ASSERT_EQ(ssLoadRet<std::vector<Sample>>(savedF3), samples);
+    ASSERT_EQ(savedF3.size(), ssSerializedSize(samples, SSDataFormat::F3));
+
+    const std::list<Event> events {{"a", {1, 2}}, {"", {}}, {std::string(300, 'x'), {3}}};
+    ASSERT_EQ(ssLoadRet<std::list<Event>>(ssSave(events)), events);
+    ASSERT_EQ(ssSave(events).size(), ssSerializedSize(events));
+
+    const std::array<Sample, 3> arr {{{1, 1.0}, {2, 2.0}, {3, 3.0}}};
+    static_assert(!SSFixedSize<std::array<Sample, 3>>::value);
+    ASSERT_EQ(ssLoadRet<decltype(arr)>(ssSave(arr)), arr);
+    ASSERT_EQ(ssSave(arr).size(), ssSerializedSize(arr));
+
+    ASSERT_EQ(ssLoadRet<std::vector<Sample>>(ssSave(std::vector<Sample>())), std::vector<Sample>());
+    ASSERT_EQ(ssSerializedSize(std::vector<Sample>(), false), Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + sizeof(uint64_t));
+
+    // In-place loading of hoisted containers uses fresh items
+    std::vector<Sample> inPlace;
+    ssLoadInPlace(saved, inPlace);
+    ASSERT_EQ(inPlace, samples);
+}
+
+TEST(SuitableStruct, HoistedFraming_Versions)
+{
+    const std::vector<Row_v1> values {{1, "one"}, {2, "two"}, {3, "three"}};
+    const auto saved = ssSave(values);
+    ASSERT_EQ(saved.size(), ssSerializedSize(values));
+    ASSERT_EQ(ssLoadRet<std::vector<Row_v1>>(saved), values);
+
+    // Older reader picks the downgraded segment
+    ASSERT_EQ(ssLoadRet<std::vector<Row_v0>>(saved), (std::vector<Row_v0>{{1}, {2}, {3}}));
+
+    // Upgrade of all items from an older segment
+    const auto savedV0 = ssSave(std::vector<Row_v0>{{5}, {6}});
+    ASSERT_EQ(ssLoadRet<std::vector<Row_v1>>(savedV0), (std::vector<Row_v1>{{5, "upgraded"}, {6, "upgraded"}}));
+
+    ASSERT_TRUE(ssValidate<std::vector<Row_v1>>(saved));
+    ASSERT_TRUE(ssValidate<std::vector<Row_v1>>(savedV0));
+}
+
+TEST(SuitableStruct, HoistedFraming_Hooks)
+{
+    const std::vector<Hooked> values(5);
+    const auto saved = ssSave(values);
+    for (const auto& x : values)
+        ASSERT_EQ(x.saves, 1);
+
+    const auto loaded = ssLoadRet<std::vector<Hooked>>(saved);
+    ASSERT_EQ(loaded.size(), values.size());
+    for (const auto& x : loaded)
+        ASSERT_EQ(x.loads, 1);
+}
+
+TEST(SuitableStruct, HoistedFraming_Corrupted)
+{
+    // Container framing around hoisted items of 'Sample'
+    const auto makeBuffer = [](uint64_t count, uint8_t version, size_t columnSize) {
+        Buffer payload;
+        payload.write(count);
+        payload.write(static_cast<uint8_t>(1));   // segments count
+        payload.write(version);
+        payload.write(static_cast<uint64_t>(columnSize));
+        payload.writeZeros(columnSize);
+
+        Buffer result;
+        result.write(static_cast<uint8_t>(1));
+        result.write(static_cast<uint8_t>(0));
+        result.write(static_cast<uint64_t>(payload.size()));
+        result += payload;
+        return result;
+    };
+
+    std::vector<Sample> loaded;
+    ssLoad(makeBuffer(1, 0, 16), loaded, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(loaded, std::vector<Sample>(1));
+
+    // Items count larger than the column can hold
+    const auto hugeCount = makeBuffer(1000000, 0, 16);
+    ASSERT_THROW(ssLoad(hugeCount, loaded, SSLoadMode::NonProtectedDefault), std::out_of_range);
+    ASSERT_FALSE(ssValidate<std::vector<Sample>>(hugeCount, SSLoadMode::NonProtectedDefault));
+
+    // Column with extra data
+    const auto extra = makeBuffer(1, 0, 17);
+    ASSERT_THROW(ssLoad(extra, loaded, SSLoadMode::NonProtectedDefault), FormatError);
+    ASSERT_FALSE(ssValidate<std::vector<Sample>>(extra, SSLoadMode::NonProtectedDefault));
+
+    // No suitable version
+    ASSERT_THROW(ssLoad(makeBuffer(1, 5, 16), loaded, SSLoadMode::NonProtectedDefault), VersionError);
+    ASSERT_EQ(loaded, std::vector<Sample>(1));
+}
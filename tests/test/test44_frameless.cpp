@@ -0,0 +1,169 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/View.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Leaf
+{
+    static constexpr bool ssFrameless = true;
+
+    int32_t a {};
+    float b {};
+
+    auto ssTuple() const { return std::tie(a, b); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Leaf)
+};
+
+struct FramedLeaf
+{
+    int32_t a {};
+    float b {};
+
+    auto ssTuple() const { return std::tie(a, b); }
+};
+
+struct Named
+{
+    static constexpr bool ssFrameless = true;
+
+    std::string name;
+    Leaf leaf;
+    std::vector<Leaf> leaves;
+
+    auto ssTuple() const { return std::tie(name, leaf, leaves); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Named)
+};
+
+struct Hooked
+{
+    static constexpr bool ssFrameless = true;
+
+    int value {};
+    mutable int saves {};
+    int loads {};
+
+    auto ssTuple() const { return std::tie(value); }
+    void ssBeforeSaveImpl() const { saves++; }
+    void ssAfterLoadImpl() { loads++; }
+};
+
+struct Root_v0
+{
+    Named named;
+    int x {};
+    using ssVersions = std::tuple<Root_v0>;
+    auto ssTuple() const { return std::tie(named, x); }
+};
+
+struct Root_v1
+{
+    Named named;
+    int x {};
+    Leaf extra;
+    using ssVersions = std::tuple<Root_v0, Root_v1>;
+    auto ssTuple() const { return std::tie(named, x, extra); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Root_v1)
+
+    void ssUpgradeFrom(const Root_v0& prev) { named = prev.named; x = prev.x; }
+    void ssDowngradeTo(Root_v0& next) const { next.named = named; next.x = x; }
+};
+
+Named makeNamed()
+{
+    return {"named", {1, 2.5f}, {{3, 4.0f}, {-5, 6.5f}}};
+}
+
+} // namespace
+
+TEST(SuitableStruct, Frameless_Layout)
+{
+    static_assert(SSFrameless<Leaf>::value);
+    static_assert(!SSFrameless<FramedLeaf>::value);
+    static_assert(SSFixedSize<Leaf>::size == sizeof(int32_t) + sizeof(float));
+    static_assert(SSFixedSize<FramedLeaf>::size == Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + SSFixedSize<Leaf>::size);
+    static_assert(!SSFixedSize<Named>::value);
+
+    const Leaf leaf {7, 1.5f};
+    const auto saved = ssSave(leaf, false);
+    ASSERT_EQ(saved.size(), sizeof(int32_t) + sizeof(float));
+    ASSERT_EQ(saved, Buffer::fromValue(leaf.a) + Buffer::fromValue(leaf.b));
+    ASSERT_EQ(ssSave(FramedLeaf{7, 1.5f}, false).size(), saved.size() + Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE);
+
+    ASSERT_EQ(ssLoadRet<Leaf>(ssSave(leaf)), leaf);
+    ASSERT_EQ(ssLoadRet<Leaf>(saved, SSLoadMode::NonProtectedDefault), leaf);
+}
+
+TEST(SuitableStruct, Frameless_SaveLoad)
+{
+    const auto named = makeNamed();
+    ASSERT_EQ(ssLoadRet<Named>(ssSave(named)), named);
+    ASSERT_EQ(ssSave(named).size(), ssSerializedSize(named));
+    ASSERT_EQ(ssLoadRet<Named>(ssSave(named, SSDataFormat::F3)), named);
+    ASSERT_EQ(ssSave(named, SSDataFormat::F3).size(), ssSerializedSize(named, SSDataFormat::F3));
+
+    const std::vector<Named> values {named, Named(), named};
+    ASSERT_EQ(ssLoadRet<std::vector<Named>>(ssSave(values)), values);
+    ASSERT_EQ(ssSave(values).size(), ssSerializedSize(values));
+
+    // Frameless members of versioned struct
+    const Root_v1 root {named, 5, {8, 9.0f}};
+    ASSERT_EQ(ssLoadRet<Root_v1>(ssSave(root)), root);
+    ASSERT_EQ(ssLoadRet<Root_v1>(ssSave(Root_v0{named, 6})), (Root_v1{named, 6, {}}));
+
+    Named inPlace;
+    ssLoadInPlace(ssSave(named), inPlace);
+    ASSERT_EQ(inPlace, named);
+
+    Hooked hooked;
+    const auto loaded = ssLoadRet<Hooked>(ssSave(hooked));
+    ASSERT_EQ(hooked.saves, 1);
+    ASSERT_EQ(loaded.loads, 1);
+}
+
+TEST(SuitableStruct, Frameless_ValidateSkipView)
+{
+    const auto named = makeNamed();
+    const auto saved = ssSave(named);
+    ASSERT_TRUE(ssValidate<Named>(saved));
+
+    const Root_v1 root {named, 5, {8, 9.0f}};
+    const auto savedRoot = ssSave(root, false);
+    ASSERT_TRUE(ssValidate<Root_v1>(savedRoot, SSLoadMode::NonProtectedDefault));
+
+    BufferReader reader(savedRoot);
+    ssSkip<Root_v1>(reader, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(reader.rest(), 0u);
+
+    // Skipped member by member
+    const auto savedMembers = ssSave(named, false);
+    BufferReader membersReader(savedMembers);
+    ssSkip<Named>(membersReader, SSLoadMode::NonProtectedDefault);
+    ASSERT_EQ(membersReader.rest(), 0u);
+
+    const auto view = ssView<Named>(saved);
+    ASSERT_EQ(view.get<0>(), named.name);
+    ASSERT_EQ(view.field<1>().get<0>(), 1);
+    ASSERT_EQ(view.get<2>(), named.leaves);
+    ASSERT_EQ(view.load(), named);
+
+    const auto savedProtectedRoot = ssSave(root);
+    const auto rootView = ssView<Root_v1>(savedProtectedRoot);
+    ASSERT_EQ(rootView.get<2>(), root.extra);
+    ASSERT_EQ(rootView.field<0>().get<2>(), named.leaves);
+
+    // Truncated data
+    auto truncated = ssSave(named, false);
+    truncated.reduceSize(2);
+    ASSERT_FALSE(ssValidate<Named>(truncated, SSLoadMode::NonProtectedDefault));
+    ASSERT_THROW((void)ssLoadRet<Named>(truncated, SSLoadMode::NonProtectedDefault), std::out_of_range);
+}
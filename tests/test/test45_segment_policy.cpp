@@ -0,0 +1,180 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Exceptions.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Data_v0
+{
+    int a {};
+    using ssVersions = std::tuple<Data_v0>;
+    auto ssTuple() const { return std::tie(a); }
+};
+
+struct Data_v1
+{
+    int a {};
+    int b {};
+    using ssVersions = std::tuple<Data_v0, Data_v1>;
+    auto ssTuple() const { return std::tie(a, b); }
+
+    void ssUpgradeFrom(const Data_v0& prev) { a = prev.a; }
+    void ssDowngradeTo(Data_v0& next) const { next.a = a; }
+};
+
+struct Data_v2
+{
+    int a {};
+    int b {};
+    int c {};
+    using ssVersions = std::tuple<Data_v0, Data_v1, Data_v2>;
+    auto ssTuple() const { return std::tie(a, b, c); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Data_v2)
+
+    void ssUpgradeFrom(const Data_v1& prev) { a = prev.a; b = prev.b; }
+    void ssDowngradeTo(Data_v1& next) const { next.a = a; next.b = b; }
+};
+
+struct Data_v3
+{
+    int a {};
+    int b {};
+    int c {};
+    int d {};
+    using ssVersions = std::tuple<Data_v0, Data_v1, Data_v2, Data_v3>;
+    auto ssTuple() const { return std::tie(a, b, c, d); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Data_v3)
+
+    void ssUpgradeFrom(const Data_v2& prev) { a = prev.a; b = prev.b; c = prev.c; }
+    void ssDowngradeTo(Data_v2& next) const { next.a = a; next.b = b; next.c = c; }
+};
+
+// Same chain, but the type itself keeps N-1 compatibility only
+struct Limited_v0
+{
+    int a {};
+    using ssVersions = std::tuple<Limited_v0>;
+    auto ssTuple() const { return std::tie(a); }
+};
+
+struct Limited_v1
+{
+    int a {};
+    using ssVersions = std::tuple<Limited_v0, Limited_v1>;
+    auto ssTuple() const { return std::tie(a); }
+    void ssUpgradeFrom(const Limited_v0& prev) { a = prev.a; }
+    void ssDowngradeTo(Limited_v0& next) const { next.a = a; }
+};
+
+struct Limited_v2
+{
+    static constexpr SSSegmentPolicy ssSegmentPolicy = SSSegmentPolicy::latest(2);
+
+    int a {};
+    using ssVersions = std::tuple<Limited_v0, Limited_v1, Limited_v2>;
+    auto ssTuple() const { return std::tie(a); }
+    void ssUpgradeFrom(const Limited_v1& prev) { a = prev.a; }
+    void ssDowngradeTo(Limited_v1& next) const { next.a = a; }
+};
+
+// Versions 0-1 are dropped
+struct Offset_v3
+{
+    int a {};
+    static constexpr uint8_t ssVersionOffset = 2;
+    using ssVersions = std::tuple<Offset_v3>;
+    auto ssTuple() const { return std::tie(a); }
+};
+
+struct Offset_v4
+{
+    int a {};
+    static constexpr uint8_t ssVersionOffset = 2;
+    using ssVersions = std::tuple<Offset_v3, Offset_v4>;
+    auto ssTuple() const { return std::tie(a); }
+    void ssUpgradeFrom(const Offset_v3& prev) { a = prev.a; }
+    void ssDowngradeTo(Offset_v3& next) const { next.a = a; }
+};
+
+struct Container
+{
+    std::vector<Data_v3> items;
+    Data_v3 single;
+    auto ssTuple() const { return std::tie(items, single); }
+};
+
+template<typename T>
+uint8_t segmentsCount(const T& obj, const SSSegmentPolicy& policy)
+{
+    Internal::SegmentPolicyScope policyScope(policy);
+    return ssSave(obj, false).cdata()[0];
+}
+
+} // namespace
+
+TEST(SuitableStruct, SegmentPolicy_Limits)
+{
+    const Data_v3 value {1, 2, 3, 4};
+
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::all()), 4);
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::latest()), 1);
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::latest(2)), 2);
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::latest(0)), 1); // The newest segment is always written
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::fromVersion(1)), 3);
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::fromVersion(5)), 1);
+    ASSERT_EQ(segmentsCount(value, SSSegmentPolicy::latest(3) & SSSegmentPolicy::fromVersion(2)), 2);
+
+    // Wire versions are compared, including offset
+    ASSERT_EQ(segmentsCount(Offset_v4{5}, SSSegmentPolicy::fromVersion(3)), 1);
+    ASSERT_EQ(segmentsCount(Offset_v4{5}, SSSegmentPolicy::fromVersion(2)), 2);
+
+    // Per type policy is combined with per call one
+    ASSERT_EQ(segmentsCount(Limited_v2{5}, SSSegmentPolicy::all()), 2);
+    ASSERT_EQ(segmentsCount(Limited_v2{5}, SSSegmentPolicy::latest()), 1);
+    ASSERT_EQ(ssSave(Limited_v2{5}, false).cdata()[0], 2);
+}
+
+TEST(SuitableStruct, SegmentPolicy_SaveLoad)
+{
+    const Data_v3 value {1, 2, 3, 4};
+
+    const auto saved = ssSave(value, SSSegmentPolicy::latest(2));
+    ASSERT_LT(saved.size(), ssSave(value).size());
+    ASSERT_EQ(saved.size(), ssSerializedSize(value, SSSegmentPolicy::latest(2)));
+    ASSERT_EQ(ssLoadRet<Data_v3>(saved), value);
+    ASSERT_EQ(ssLoadRet<Data_v2>(saved), (Data_v2{1, 2, 3}));
+    ASSERT_THROW((void)ssLoadRet<Data_v1>(saved), VersionError);
+
+    // Policy is restored after the call
+    ASSERT_EQ(Internal::currentSegmentPolicy(), SSSegmentPolicy::all());
+    ASSERT_EQ(ssSave(value, false).cdata()[0], 4);
+
+    const auto savedF3 = ssSave(value, SSSegmentPolicy::latest(), SSDataFormat::F3);
+    ASSERT_EQ(savedF3.size(), ssSerializedSize(value, SSSegmentPolicy::latest(), SSDataFormat::F3));
+    ASSERT_EQ(ssLoadRet<Data_v3>(savedF3), value);
+
+    Buffer appended;
+    BufferWriter writer(appended);
+    ssSaveTo(writer, value, SSSegmentPolicy::latest(2));
+    ASSERT_EQ(appended, saved);
+
+    // Nested objects follow the policy
+    Container container;
+    container.items.assign(10, value);
+    container.single = value;
+    const auto savedContainer = ssSave(container, SSSegmentPolicy::latest());
+    ASSERT_EQ(savedContainer.size(), ssSerializedSize(container, SSSegmentPolicy::latest()));
+    ASSERT_LT(savedContainer.size() * 2, ssSave(container).size());
+
+    const auto loaded = ssLoadRet<Container>(savedContainer);
+    ASSERT_EQ(loaded.items, container.items);
+    ASSERT_EQ(loaded.single, container.single);
+}
@@ -0,0 +1,138 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+// Counts copies of the payload passed through the upgrade chain
+struct Tracked
+{
+    static inline int copies = 0;
+
+    std::vector<int> values;
+
+    Tracked() = default;
+    Tracked(std::vector<int> values): values(std::move(values)) { }
+    Tracked(const Tracked& rhs): values(rhs.values) { copies++; }
+    Tracked(Tracked&&) = default;
+    Tracked& operator=(const Tracked& rhs) { values = rhs.values; copies++; return *this; }
+    Tracked& operator=(Tracked&&) = default;
+
+    auto ssTuple() const { return std::tie(values); }
+};
+
+struct Data_v0
+{
+    Tracked payload;
+    using ssVersions = std::tuple<Data_v0>;
+    auto ssTuple() const { return std::tie(payload); }
+};
+
+struct Data_v1
+{
+    Tracked payload;
+    int a {};
+    using ssVersions = std::tuple<Data_v0, Data_v1>;
+    auto ssTuple() const { return std::tie(payload, a); }
+
+    void ssUpgradeFrom(const Data_v0& prev) { payload = prev.payload; a = -1; }
+    void ssUpgradeFrom(Data_v0&& prev) { payload = std::move(prev.payload); a = 1; }
+};
+
+struct Data_v2
+{
+    Tracked payload;
+    int a {};
+    int b {};
+    using ssVersions = std::tuple<Data_v0, Data_v1, Data_v2>;
+    auto ssTuple() const { return std::tie(payload, a, b); }
+
+    // Only the move-based upgrade
+    void ssUpgradeFrom(Data_v1&& prev) { payload = std::move(prev.payload); a = prev.a; b = 2; }
+};
+
+struct Data_v3
+{
+    Tracked payload;
+    int a {};
+    int b {};
+    int c {};
+    using ssVersions = std::tuple<Data_v0, Data_v1, Data_v2, Data_v3>;
+    auto ssTuple() const { return std::tie(payload, a, b, c); }
+
+    // Only the copy-based upgrade
+    void ssUpgradeFrom(const Data_v2& prev) { payload.values = prev.payload.values; a = prev.a; b = prev.b; c = 3; }
+};
+
+// Upgrade via Handlers, moving from the source
+struct External_v0
+{
+    std::unique_ptr<int> value;
+    using ssVersions = std::tuple<External_v0>;
+    auto ssTuple() const { return std::tie(value); }
+};
+
+struct External_v1
+{
+    std::unique_ptr<int> value;
+    using ssVersions = std::tuple<External_v0, External_v1>;
+    auto ssTuple() const { return std::tie(value); }
+};
+
+} // namespace
+
+// Serialization stays with the type, only the upgrade is external
+namespace SuitableStruct {
+template<>
+struct Handlers<External_v1> : public std::false_type
+{
+    static void ssUpgradeFrom(External_v0&& prev, External_v1& next) { next.value = std::move(prev.value); }
+};
+} // namespace SuitableStruct
+
+TEST(SuitableStruct, UpgradeChain_PrefersMove)
+{
+    const auto saved = ssSave(Data_v0{Tracked({1, 2, 3})});
+
+    Tracked::copies = 0;
+    const auto v1 = ssLoadRet<Data_v1>(saved);
+    ASSERT_EQ(v1.a, 1);
+    ASSERT_EQ(v1.payload.values, (std::vector<int>{1, 2, 3}));
+
+    const auto v2 = ssLoadRet<Data_v2>(saved);
+    ASSERT_EQ(v2.a, 1);
+    ASSERT_EQ(v2.b, 2);
+    ASSERT_EQ(Tracked::copies, 0);
+
+    const auto v3 = ssLoadRet<Data_v3>(saved);
+    ASSERT_EQ(v3.a, 1);
+    ASSERT_EQ(v3.b, 2);
+    ASSERT_EQ(v3.c, 3);
+    ASSERT_EQ(v3.payload.values, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(Tracked::copies, 0);
+
+    // Whole container of old records
+    const auto savedItems = ssSave(std::vector<Data_v0>(10, Data_v0{Tracked({4, 5})}));
+    Tracked::copies = 0;
+    const auto items = ssLoadRet<std::vector<Data_v2>>(savedItems);
+    ASSERT_EQ(items.size(), 10u);
+    ASSERT_EQ(items.back().payload.values, (std::vector<int>{4, 5}));
+    ASSERT_EQ(Tracked::copies, 0);
+}
+
+TEST(SuitableStruct, UpgradeChain_Handlers)
+{
+    External_v0 value;
+    value.value = std::make_unique<int>(42);
+
+    const auto loaded = ssLoadRet<External_v1>(ssSave(value));
+    ASSERT_TRUE(loaded.value);
+    ASSERT_EQ(*loaded.value, 42);
+}
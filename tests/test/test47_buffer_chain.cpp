@@ -0,0 +1,167 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/BufferChain.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Image_v0
+{
+    std::string name;
+    std::shared_ptr<std::vector<uint8_t>> pixels;
+
+    using ssVersions = std::tuple<Image_v0>;
+    auto ssTuple() const { return std::tie(name, pixels); }
+};
+
+struct Image_v1
+{
+    std::string name;
+    std::shared_ptr<std::vector<uint8_t>> pixels;
+    std::shared_ptr<std::string> description;
+    std::string notes;
+
+    using ssVersions = std::tuple<Image_v0, Image_v1>;
+    auto ssTuple() const { return std::tie(name, pixels, description, notes); }
+
+    void ssUpgradeFrom(const Image_v0& prev) { name = prev.name; pixels = prev.pixels; }
+    void ssDowngradeTo(Image_v0& next) const { next.name = name; next.pixels = pixels; }
+};
+
+Image_v1 makeImage()
+{
+    Image_v1 image;
+    image.name = "image";
+    image.pixels = std::make_shared<std::vector<uint8_t>>(100000);
+    for (size_t i = 0; i < image.pixels->size(); i++)
+        (*image.pixels)[i] = static_cast<uint8_t>(i * 7);
+    image.description = std::make_shared<std::string>(20000, 'd');
+    image.notes = std::string(10000, 'n'); // Not shared, copied
+    return image;
+}
+
+bool references(const BufferChain& chain, const void* data)
+{
+    for (const auto& x : chain.chunks())
+        if (x.data == data)
+            return true;
+    return false;
+}
+
+} // namespace
+
+TEST(SuitableStruct, BufferChain_Basics)
+{
+    BufferChain chain;
+    ASSERT_TRUE(chain.empty());
+    ASSERT_EQ(chain, Buffer());
+
+    chain.append(Buffer::fromConstChar("abc"));
+    auto shared = std::make_shared<const Buffer>(Buffer::fromConstChar("defgh"));
+    chain.appendShared(shared);
+    chain.append(Buffer());
+    chain.append(Buffer::fromConstChar("ij"));
+
+    const auto flat = Buffer::fromConstChar("abcdefghij");
+    ASSERT_EQ(chain.size(), flat.size());
+    ASSERT_EQ(chain.chunks().size(), 3u);
+    ASSERT_EQ(chain.chunks()[1].data, shared->cdata());
+    ASSERT_EQ(chain.toBuffer(), flat);
+    ASSERT_EQ(chain, flat);
+    ASSERT_NE(chain, Buffer::fromConstChar("abcdefghiJ"));
+    ASSERT_EQ(chain.hash(), flat.hash());
+
+    // Same bytes, different chunks
+    BufferChain other(Buffer::fromConstChar("abcd"));
+    other.append(Buffer::fromConstChar("efghij"));
+    ASSERT_EQ(chain, other);
+
+    BufferChain joined;
+    joined.append(chain);
+    joined.append(other);
+    ASSERT_EQ(joined.toBuffer(), flat + flat);
+
+#ifdef SUITABLE_STRUCT_HAS_IOVEC
+    const auto iovecs = chain.iovecs();
+    ASSERT_EQ(iovecs.size(), chain.chunks().size());
+    ASSERT_EQ(iovecs[1].iov_base, shared->cdata());
+    ASSERT_EQ(iovecs[1].iov_len, shared->size());
+#endif
+}
+
+TEST(SuitableStruct, BufferChain_Save)
+{
+    auto image = makeImage();
+
+    for (auto format : {SSDataFormat::F1, SSDataFormat::F2, SSDataFormat::F3}) {
+        const auto saved = ssSave(image, format);
+        const auto chain = ssSaveChain(image, format);
+        ASSERT_EQ(chain, saved);
+        ASSERT_TRUE(references(chain, image.pixels->data()));
+        ASSERT_TRUE(references(chain, image.description->data()));
+        ASSERT_FALSE(references(chain, image.notes.data()));
+
+        const auto loaded = ssLoadRet<Image_v1>(chain.toBuffer());
+        ASSERT_EQ(*loaded.pixels, *image.pixels);
+        ASSERT_EQ(*loaded.description, *image.description);
+        ASSERT_EQ(ssLoadRet<Image_v0>(chain.toBuffer()).name, image.name);
+    }
+
+    // Chunks keep the payload alive
+    const auto saved = ssSave(image);
+    const auto chain = ssSaveChain(image);
+    image = Image_v1();
+    ASSERT_EQ(chain, saved);
+
+    // Below the threshold everything is copied
+    const auto small = makeImage();
+    const auto copied = ssSaveChain(small, SSDataFormat::F1, 1000000);
+    ASSERT_EQ(copied.chunks().size(), 1u);
+    ASSERT_EQ(copied, ssSave(small));
+}
+
+TEST(SuitableStruct, BufferChain_Writer)
+{
+    const auto payload = std::make_shared<const Buffer>(Buffer(100));
+
+    Buffer buffer;
+    buffer.write(static_cast<uint8_t>(1)); // Before the writer
+    BufferWriter writer(buffer, 10);
+    ASSERT_TRUE(writer.isChained());
+
+    const auto before = writer.writePlaceholder<uint32_t>();
+    writer.writeShared(payload->cdata(), payload->size(), payload);
+    const auto after = writer.writePlaceholder<uint32_t>();
+    writer.writeShared(payload->cdata(), 5, payload); // Small, copied
+
+    ASSERT_EQ(writer.position(), sizeof(uint32_t) * 2 + 105);
+    ASSERT_EQ(after, sizeof(uint32_t) + 100);
+    writer.patch(before, uint32_t(10));
+    writer.patch(after, uint32_t(20));
+    ASSERT_THROW(writer.patch(before + 2, uint32_t(0)), std::out_of_range);
+    ASSERT_THROW((void)writer.data(before + 10), std::out_of_range);
+    ASSERT_EQ(*writer.data(after), 20);
+
+    Buffer expected;
+    expected.write(static_cast<uint8_t>(1));
+    expected.write(uint32_t(10));
+    expected += *payload;
+    expected.write(uint32_t(20));
+    expected.writeRaw(payload->cdata(), 5);
+
+    const auto whole = Buffer(expected.cdata() + 1, expected.size() - 1);
+    ASSERT_EQ(writer.hash(0, writer.position()), whole.hash());
+
+    const auto chain = writer.takeChain();
+    ASSERT_EQ(chain, expected);
+    ASSERT_EQ(chain.chunks().size(), 3u);
+    ASSERT_EQ(buffer.size(), 0u);
+}
@@ -0,0 +1,138 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t allocations {};
+    size_t allocated {};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations++;
+        allocated += bytes;
+        return m_upstream.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        m_upstream.deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::monotonic_buffer_resource m_upstream;
+};
+
+// Allocator-aware struct
+struct Record
+{
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    std::pmr::string name;
+    std::pmr::vector<int> values;
+
+    Record() = default;
+    explicit Record(const allocator_type& allocator): name(allocator), values(allocator) { }
+    Record(const Record& rhs, const allocator_type& allocator): name(rhs.name, allocator), values(rhs.values, allocator) { }
+    Record(Record&& rhs, const allocator_type& allocator): name(std::move(rhs.name), allocator), values(std::move(rhs.values), allocator) { }
+    Record(const Record&) = default;
+    Record(Record&&) = default;
+    Record& operator=(const Record&) = default;
+    Record& operator=(Record&&) = default;
+
+    auto ssTuple() const { return std::tie(name, values); }
+    SS_COMPARISONS_MEMBER(Record);
+};
+
+} // namespace
+
+TEST(SuitableStruct, MemoryResource_Buffer)
+{
+    CountingResource resource;
+
+    Buffer buffer(&resource);
+    ASSERT_EQ(buffer.memoryResource(), &resource);
+    ASSERT_EQ(resource.allocations, 0u); // Short data stays inline
+
+    buffer += Buffer(1000);
+    ASSERT_EQ(buffer.size(), 1000u);
+    ASSERT_GE(resource.allocated, 1000u);
+
+    // Copies and moves keep their own resource
+    Buffer copy(buffer);
+    ASSERT_EQ(copy, buffer);
+    ASSERT_EQ(copy.memoryResource(), std::pmr::get_default_resource());
+
+    Buffer moved(std::move(buffer));
+    ASSERT_EQ(moved.memoryResource(), &resource);
+    ASSERT_EQ(moved.size(), 1000u);
+    ASSERT_EQ(buffer.size(), 0u); // NOLINT(bugprone-use-after-move)
+
+    const auto saved = ssSave(std::vector<int>(1000, 5), &resource);
+    ASSERT_EQ(saved.memoryResource(), &resource);
+    ASSERT_EQ(saved, ssSave(std::vector<int>(1000, 5)));
+}
+
+TEST(SuitableStruct, MemoryResource_Load)
+{
+    const std::vector<std::string> strings(10, std::string(100, 'x'));
+    const auto saved = ssSave(strings);
+
+    // Same data as 'std::string'
+    std::pmr::vector<std::pmr::string> pmrStrings(strings.begin(), strings.end());
+    ASSERT_EQ(ssSave(pmrStrings), saved);
+
+    CountingResource resource;
+    const auto loaded = ssLoadRet<std::pmr::vector<std::pmr::string>>(saved, &resource);
+    ASSERT_EQ(loaded, pmrStrings);
+    ASSERT_EQ(loaded.get_allocator().resource(), &resource);
+    ASSERT_EQ(loaded.back().get_allocator().resource(), &resource);
+    ASSERT_GE(resource.allocated, 1000u);
+
+    // Without resource
+    const auto regular = ssLoadRet<std::pmr::vector<std::pmr::string>>(saved);
+    ASSERT_EQ(regular.get_allocator().resource(), std::pmr::get_default_resource());
+
+    // Existing object keeps its resource
+    CountingResource other;
+    std::pmr::vector<std::pmr::string> target(&other);
+    ssLoad(saved, target, &resource);
+    ASSERT_EQ(target, pmrStrings);
+    ASSERT_EQ(target.get_allocator().resource(), &other);
+    ASSERT_EQ(target.back().get_allocator().resource(), &other);
+}
+
+TEST(SuitableStruct, MemoryResource_Struct)
+{
+    Record record;
+    record.name = std::pmr::string(100, 'r');
+    record.values.assign(100, 7);
+    const auto saved = ssSave(std::vector<Record>(3, record));
+
+    CountingResource resource;
+    const auto loaded = ssLoadRet<Record>(ssSave(record), &resource);
+    ASSERT_EQ(loaded, record);
+    ASSERT_EQ(loaded.name.get_allocator().resource(), &resource);
+    ASSERT_EQ(loaded.values.get_allocator().resource(), &resource);
+
+    const auto items = ssLoadRet<std::pmr::vector<Record>>(saved, &resource);
+    ASSERT_EQ(items.size(), 3u);
+    ASSERT_EQ(items.back(), record);
+    ASSERT_EQ(items.back().values.get_allocator().resource(), &resource);
+}
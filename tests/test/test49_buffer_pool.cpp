@@ -0,0 +1,149 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <thread>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Item
+{
+    std::string name;
+    std::vector<int> values;
+    auto ssTuple() const { return std::tie(name, values); }
+};
+
+// Restores pool limit and frees retained buffers
+struct PoolGuard
+{
+    PoolGuard() { ssClearBufferPool(); }
+    ~PoolGuard() { ssSetBufferPoolLimit(SSDefaultBufferPoolLimit); ssClearBufferPool(); }
+};
+
+} // namespace
+
+TEST(SuitableStruct, BufferPool_Reuse)
+{
+    PoolGuard guard;
+    const auto initial = ssBufferPoolStats();
+    ASSERT_EQ(initial.buffersRetained, 0u);
+    ASSERT_EQ(initial.bytesRetained, 0u);
+
+    {
+        Buffer buffer(1000);
+        const auto stats = ssBufferPoolStats();
+        ASSERT_EQ(stats.misses, initial.misses + 1);
+        ASSERT_EQ(stats.hits, initial.hits);
+    }
+
+    auto stats = ssBufferPoolStats();
+    ASSERT_EQ(stats.buffersRetained, 1u);
+    ASSERT_GE(stats.bytesRetained, 1000u);
+
+    {
+        const Buffer buffer(500);
+        ASSERT_EQ(std::count(buffer.cdata(), buffer.cdata() + buffer.size(), 0), 500);
+        ASSERT_GE(buffer.capacity(), 1000u); // Pooled one
+        stats = ssBufferPoolStats();
+        ASSERT_EQ(stats.hits, initial.hits + 1);
+        ASSERT_EQ(stats.buffersRetained, 0u);
+        ASSERT_EQ(stats.bytesRetained, 0u);
+    }
+
+    // Short buffers don't use the pool
+    {
+        const Buffer buffer(Buffer::InlineCapacity);
+        ASSERT_EQ(ssBufferPoolStats().hits, initial.hits + 1);
+    }
+
+    // Saves of same shape
+    const std::vector<Item> items(10, Item{std::string(100, 'x'), {1, 2, 3}});
+    const auto saved = ssSave(items);
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(ssSave(items), saved);
+    ASSERT_GE(ssBufferPoolStats().hits, initial.hits + 10);
+
+    ssClearBufferPool();
+    ASSERT_EQ(ssBufferPoolStats().buffersRetained, 0u);
+}
+
+TEST(SuitableStruct, BufferPool_Limit)
+{
+    PoolGuard guard;
+
+    ssSetBufferPoolLimit(2000);
+    ASSERT_EQ(ssBufferPoolLimit(), 2000u);
+
+    { Buffer buffer(5000); }
+    ASSERT_EQ(ssBufferPoolStats().buffersRetained, 0u);
+
+    {
+        Buffer b1(1000);
+        Buffer b2(900);
+        Buffer b3(900);
+    }
+    const auto stats = ssBufferPoolStats();
+    ASSERT_EQ(stats.buffersRetained, 2u);
+    ASSERT_LE(stats.bytesRetained, 2000u);
+
+    // Disabled
+    ssClearBufferPool();
+    ssSetBufferPoolLimit(0);
+    { Buffer buffer(1000); }
+    ASSERT_EQ(ssBufferPoolStats().buffersRetained, 0u);
+}
+
+TEST(SuitableStruct, BufferPool_OtherResources)
+{
+    PoolGuard guard;
+    std::pmr::monotonic_buffer_resource resource;
+
+    {
+        Buffer buffer(&resource);
+        buffer.writeZeros(1000);
+    }
+    ASSERT_EQ(ssBufferPoolStats().buffersRetained, 0u);
+
+    // Per-thread pools
+    { Buffer buffer(1000); }
+    ASSERT_EQ(ssBufferPoolStats().buffersRetained, 1u);
+
+    std::thread([]() {
+        ASSERT_EQ(ssBufferPoolStats().buffersRetained, 0u);
+        { Buffer buffer(1000); }
+        ASSERT_EQ(ssBufferPoolStats().buffersRetained, 1u);
+    }).join();
+}
+
+TEST(SuitableStruct, BufferPool_SaveToBuffer)
+{
+    const std::vector<Item> items(10, Item{std::string(100, 'x'), {1, 2, 3}});
+    const auto expected = ssSave(items);
+
+    Buffer buffer;
+    ssSaveTo(buffer, items, SSDataFormat::F1);
+    ASSERT_EQ(buffer, expected);
+    const auto capacity = buffer.capacity();
+    const auto data = buffer.cdata();
+
+    // Capacity is reused
+    for (int i = 0; i < 5; i++) {
+        buffer.clear();
+        ssSaveTo(buffer, items);
+        ASSERT_EQ(buffer, expected);
+        ASSERT_EQ(buffer.capacity(), capacity);
+        ASSERT_EQ(buffer.cdata(), data);
+    }
+
+    // Appends
+    ssSaveTo(buffer, 5, false);
+    ASSERT_EQ(buffer, expected + Buffer::fromValue(5));
+    ssSaveTo(buffer, items, SSDataFormat::F3);
+    ASSERT_EQ(buffer, expected + Buffer::fromValue(5) + ssSave(items, SSDataFormat::F3));
+}
@@ -0,0 +1,127 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Containers/vector.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+// Size can't be computed up front
+struct Message
+{
+    std::string text;
+
+    Buffer ssSaveImpl() const { return ::SuitableStruct::ssSaveImpl(text); }
+    void ssLoadImpl(BufferReader& reader) { ::SuitableStruct::ssLoadImpl(reader, text); }
+};
+
+struct Report
+{
+    std::string text;
+
+    Buffer ssSaveImpl() const { return ::SuitableStruct::ssSaveImpl(text); }
+    void ssLoadImpl(BufferReader& reader) { ::SuitableStruct::ssLoadImpl(reader, text); }
+};
+
+struct Seeded
+{
+    std::vector<int> values;
+    auto ssTuple() const { return std::tie(values); }
+};
+
+struct Fixed
+{
+    int a {};
+    auto ssTuple() const { return std::tie(a); }
+};
+
+// Capacity of a fresh buffer is what was reserved
+struct NoPoolGuard
+{
+    NoPoolGuard() { ssSetBufferPoolLimit(0); ssClearBufferPool(); }
+    ~NoPoolGuard() { ssSetBufferPoolLimit(SSDefaultBufferPoolLimit); }
+};
+
+} // namespace
+
+TEST(SuitableStruct, SizeHints_Learned)
+{
+    NoPoolGuard guard;
+    ASSERT_EQ(ssSizeHint<Message>(), 0u);
+
+    const auto saved = ssSave(Message{std::string(10000, 'm')});
+    ASSERT_EQ(ssSizeHint<Message>(), saved.size());
+
+    // Steady state: reserved once, exactly
+    const auto next = ssSave(Message{std::string(10000, 'n')});
+    ASSERT_EQ(next.size(), saved.size());
+    ASSERT_EQ(next.capacity(), saved.size());
+    ASSERT_EQ(ssLoadRet<Message>(next).text, std::string(10000, 'n'));
+
+    // Unprotected saves share the estimate
+    const auto unprotected = ssSave(Message{std::string(10000, 'u')}, false);
+    ASSERT_EQ(unprotected.capacity(), unprotected.size());
+    ASSERT_EQ(ssSizeHint<Message>(), saved.size());
+
+    // Moving average
+    const auto larger = ssSave(Message{std::string(20000, 'l')});
+    ASSERT_GT(ssSizeHint<Message>(), saved.size());
+    ASSERT_LT(ssSizeHint<Message>(), larger.size());
+
+    for (int i = 0; i < 50; i++)
+        (void)ssSave(Message{std::string(20000, 'l')});
+    ASSERT_EQ(ssSizeHint<Message>(), larger.size());
+
+    for (int i = 0; i < 50; i++)
+        (void)ssSave(Message{std::string(100, 's')}, false);
+    ASSERT_LT(ssSizeHint<Message>(), Internal::SS_PROTECTED_HEADER_SIZE + 200);
+}
+
+TEST(SuitableStruct, SizeHints_SmallAfterLarge)
+{
+    NoPoolGuard guard;
+
+    const auto large = ssSave(Report{std::string(1000000, 'l')});
+    ASSERT_EQ(ssSizeHint<Report>(SSDataFormat::F1), large.size());
+
+    // Reserved for the estimate and kept, no reallocation before returning
+    const auto small = ssSave(Report{std::string(1000, 's')});
+    ASSERT_GE(small.capacity(), large.size() - Internal::SS_PROTECTED_HEADER_SIZE);
+    ASSERT_EQ(ssLoadRet<Report>(small).text, std::string(1000, 's'));
+
+    // Formats with other layout have own estimates
+    ASSERT_EQ(ssSizeHint<Report>(SSDataFormat::F3), 0u);
+    const auto compact = ssSave(Report{std::string(100, 'c')}, SSDataFormat::F3);
+    ASSERT_EQ(ssSizeHint<Report>(SSDataFormat::F3), compact.size());
+    ASSERT_EQ(ssSizeHint<Report>(SSDataFormat::F2), ssSizeHint<Report>(SSDataFormat::F1));
+    ASSERT_GT(ssSizeHint<Report>(SSDataFormat::F1), 100000u);
+
+    // Estimate decays towards small sizes
+    size_t saves = 1;
+    for (; saves < 100; saves++)
+        if (ssSave(Report{std::string(1000, 's')}).capacity() <= small.size() * 2)
+            break;
+    ASSERT_LT(saves, 40u);
+    ASSERT_LE(ssSizeHint<Report>(SSDataFormat::F1), small.size() * 2);
+}
+
+TEST(SuitableStruct, SizeHints_Seeded)
+{
+    NoPoolGuard guard;
+
+    ssSetSizeHint<Seeded>(5000);
+    ASSERT_EQ(ssSizeHint<Seeded>(), 5000u);
+
+    const auto saved = ssSave(Seeded{std::vector<int>(1000, 1)});
+    ASSERT_GE(saved.capacity(), 5000u);
+    ASSERT_LT(ssSizeHint<Seeded>(), 5000u);
+    ASSERT_GT(ssSizeHint<Seeded>(), saved.size());
+
+    // Fixed-size types are reserved exactly, without hints
+    (void)ssSave(Fixed{1});
+    ASSERT_EQ(ssSizeHint<Fixed>(), 0u);
+}
@@ -0,0 +1,179 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/ArrayView.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/deque.h>
+#include <SuitableStruct/Containers/map.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Item_v0
+{
+    int id {};
+    using ssVersions = std::tuple<Item_v0>;
+    auto ssTuple() const { return std::tie(id); }
+};
+
+struct Item
+{
+    int id {};
+    std::string name;
+    std::vector<int> values;
+    std::map<int, std::string> tags;
+
+    using ssVersions = std::tuple<Item_v0, Item>;
+    auto ssTuple() const { return std::tie(id, name, values, tags); }
+    void ssUpgradeFrom(const Item_v0& prev) { id = prev.id; }
+    void ssDowngradeTo(Item_v0& next) const { next.id = id; }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Item)
+};
+
+std::vector<Item> makeItems(size_t count)
+{
+    std::vector<Item> result(count);
+    for (size_t i = 0; i < count; i++) {
+        auto& x = result[i];
+        x.id = static_cast<int>(i);
+        x.name = std::string(i % 200, 'n'); // Different varint sizes in F3
+        x.values.assign(i % 7, static_cast<int>(i));
+        if (i % 3 == 0)
+            x.tags[static_cast<int>(i)] = "tag";
+    }
+    return result;
+}
+
+// Records saving threads
+struct Probe
+{
+    static inline std::mutex mutex;
+    static inline std::set<std::thread::id> threads;
+    static inline int throwOn = -1;
+
+    int value {};
+
+    Buffer ssSaveImpl() const {
+        if (value == throwOn)
+            throw std::runtime_error("Probe");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        {
+            std::lock_guard lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        return ::SuitableStruct::ssSaveImpl(value);
+    }
+
+    void ssLoadImpl(BufferReader& reader) { ::SuitableStruct::ssLoadImpl(reader, value); }
+};
+
+struct Aligned
+{
+    int8_t id {};
+    ArrayView<double> values;
+    auto ssTuple() const { return std::tie(id, values); }
+};
+
+struct Node
+{
+    int value {};
+    std::vector<Node> children;
+    auto ssTuple() const { return std::tie(value, children); }
+};
+
+// Position dependence is found at compile time from item types
+static_assert(Internal::ssIsPositionDependent<Aligned>());
+static_assert(Internal::ssIsPositionDependent<std::optional<std::vector<Aligned>>>());
+static_assert(Internal::ssIsPositionDependent<std::pair<int, ArrayView<int32_t>>>());
+static_assert(!Internal::ssIsPositionDependent<ArrayView<char>>());
+static_assert(!Internal::ssIsPositionDependent<Item>());
+static_assert(!Internal::ssIsPositionDependent<Probe>());
+static_assert(!Internal::ssIsPositionDependent<Node>());
+
+} // namespace
+
+TEST(SuitableStruct, ParallelSave_SameData)
+{
+    const auto items = makeItems(10000);
+
+    for (auto format : {SSDataFormat::F1, SSDataFormat::F2, SSDataFormat::F3}) {
+        const auto sequential = ssSave(items, format);
+        ASSERT_EQ(ssSave(items, SSParallelSave{4, 100}, format), sequential);
+        ASSERT_EQ(ssSave(items, SSParallelSave{3, 777}, format), sequential);
+        ASSERT_EQ(ssSave(items, SSParallelSave{1, 100}, format), sequential);
+        ASSERT_EQ(ssSave(items, SSParallelSave{0, 1}, format), sequential);
+        ASSERT_EQ(ssSave(items, SSParallelSave{}, format), sequential);
+    }
+
+    // Segment policy is applied in all threads
+    {
+        const auto sequential = ssSave(items, SSSegmentPolicy::latest());
+        Internal::ParallelSaveScope parallelScope(SSParallelSave{4, 100});
+        ASSERT_EQ(ssSave(items, SSSegmentPolicy::latest()), sequential);
+    }
+
+    // Other random access containers, nesting
+    const std::deque<Item> deque(items.begin(), items.end());
+    ASSERT_EQ(ssSave(deque, SSParallelSave{4, 100}), ssSave(deque));
+
+    const std::vector<std::vector<Item>> nested(20, makeItems(300));
+    ASSERT_EQ(ssSave(nested, SSParallelSave{4, 3}), ssSave(nested));
+
+    const auto loaded = ssLoadRet<std::vector<Item>>(ssSave(items, SSParallelSave{4, 100}));
+    ASSERT_EQ(loaded, items);
+
+    Buffer buffer = Buffer::fromConstChar("header");
+    BufferWriter writer(buffer);
+    ssSaveTo(writer, items, SSParallelSave{4, 100});
+    ASSERT_EQ(buffer, Buffer::fromConstChar("header") + ssSave(items));
+
+    // Chained save is sequential
+    Internal::ParallelSaveScope parallelScope(SSParallelSave{4, 100});
+    ASSERT_EQ(ssSaveChain(items), ssSave(items));
+}
+
+TEST(SuitableStruct, ParallelSave_Threads)
+{
+    std::vector<Probe> probes(16);
+    for (size_t i = 0; i < probes.size(); i++)
+        probes[i].value = static_cast<int>(i);
+
+    const auto sequential = ssSave(probes);
+    Probe::threads.clear();
+    ASSERT_EQ(ssSave(probes, SSParallelSave{4, 1}), sequential);
+    ASSERT_GT(Probe::threads.size(), 1u);
+    ASSERT_LE(Probe::threads.size(), 4u);
+
+    // Worker threads are reused by next saves
+    ASSERT_EQ(ssSave(probes, SSParallelSave{4, 1}), sequential);
+    ASSERT_LE(Probe::threads.size(), 4u);
+
+    // Exceptions of other threads are rethrown
+    Probe::throwOn = 13;
+    ASSERT_THROW((void)ssSave(probes, SSParallelSave{4, 1}), std::runtime_error);
+    Probe::throwOn = -1;
+}
+
+TEST(SuitableStruct, ParallelSave_PositionDependent)
+{
+    // Alignment padding of ArrayView depends on the absolute position, so saved sequentially
+    const std::vector<double> values {1.5, 2.5, 3.5};
+    std::vector<Aligned> items(1000);
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i].id = static_cast<int8_t>(i);
+        items[i].values = ArrayView<double>(values.data(), i % 4);
+    }
+
+    ASSERT_EQ(ssSave(items, SSParallelSave{4, 10}), ssSave(items));
+}
@@ -0,0 +1,284 @@
+/* License:  MIT
+ * Source:   https://github.com/ihor-drachuk/SuitableStruct
+ * Contact:  ihor-drachuk-libs@pm.me  */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory_resource>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <SuitableStruct/Serializer.h>
+#include <SuitableStruct/Comparisons.h>
+#include <SuitableStruct/View.h>
+#include <SuitableStruct/Containers/vector.h>
+#include <SuitableStruct/Containers/list.h>
+#include <SuitableStruct/Containers/map.h>
+#include <SuitableStruct/Containers/array.h>
+
+using namespace SuitableStruct;
+
+namespace {
+
+struct Item
+{
+    int id {};
+    std::string name;
+    std::vector<int> values;
+
+    auto ssTuple() const { return std::tie(id, name, values); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Item)
+};
+
+struct Snapshot
+{
+    std::string title;
+    std::vector<Item> items;
+    std::map<int, std::string> names;
+    std::array<int, 3> fixed {};
+
+    auto ssTuple() const { return std::tie(title, items, names, fixed); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Snapshot)
+};
+
+struct Point
+{
+    int x {};
+    int y {};
+    auto ssTuple() const { return std::tie(x, y); }
+    SS_COMPARISONS_MEMBER_ONLY_EQ(Point)
+};
+
+// Records loading threads
+struct Probe
+{
+    static inline std::mutex mutex;
+    static inline std::set<std::thread::id> threads;
+    static inline int throwOn = -1;
+
+    std::string value;
+
+    Buffer ssSaveImpl() const { return ::SuitableStruct::ssSaveImpl(value); }
+
+    void ssLoadImpl(BufferReader& reader) {
+        ::SuitableStruct::ssLoadImpl(reader, value);
+        if (value == std::to_string(throwOn))
+            throw std::runtime_error("Probe");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    }
+};
+
+std::vector<Item> makeItems(size_t count)
+{
+    std::vector<Item> result(count);
+    for (size_t i = 0; i < count; i++) {
+        auto& x = result[i];
+        x.id = static_cast<int>(i);
+        x.name = std::string(i % 50, 'n');
+        x.values.assign(i % 5, static_cast<int>(i));
+    }
+    return result;
+}
+
+Snapshot makeSnapshot(size_t count)
+{
+    Snapshot result;
+    result.title = "snapshot";
+    result.items = makeItems(count);
+    for (size_t i = 0; i < count; i++)
+        result.names[static_cast<int>(i)] = std::to_string(i);
+    result.fixed = {1, 2, 3};
+    return result;
+}
+
+} // namespace
+
+TEST(SuitableStruct, IndexedContainers_RoundTrip)
+{
+    const auto snapshot = makeSnapshot(10000);
+    const auto saved = ssSave(snapshot, SSDataFormat::F4);
+
+    ASSERT_EQ(ssDetectFormat(saved), SSDataFormat::F4);
+    ASSERT_EQ(saved.size(), ssSerializedSize(snapshot, SSDataFormat::F4));
+    ASSERT_GT(saved.size(), ssSerializedSize(snapshot, SSDataFormat::F2)); // Indexes of 'items' & 'names'
+    ASSERT_TRUE(ssValidate<Snapshot>(saved));
+    ASSERT_EQ(ssLoadRet<Snapshot>(saved), snapshot);
+
+    // Small containers have no index: 1 byte each for 'items' & 'names'
+    const auto small = makeSnapshot(100);
+    ASSERT_EQ(ssSave(small, SSDataFormat::F4).size(), ssSave(small, SSDataFormat::F2).size() + 2);
+    ASSERT_EQ(ssLoadRet<Snapshot>(ssSave(small, SSDataFormat::F4)), small);
+
+    // Same data with parallel save; chunks follow its grain
+    ASSERT_EQ(ssSave(snapshot, SSParallelSave{4, SSParallelSave{}.grain}, SSDataFormat::F4), saved);
+    const auto fineGrained = ssSave(snapshot, SSParallelSave{4, 100}, SSDataFormat::F4);
+    ASSERT_GT(fineGrained.size(), saved.size());
+    ASSERT_EQ(ssLoadRet<Snapshot>(fineGrained), snapshot);
+
+    {
+        Internal::ParallelSaveScope parallelScope(SSParallelSave{1, 100});
+        ASSERT_EQ(ssSave(snapshot, SSDataFormat::F4), fineGrained); // Single thread: sequential
+        ASSERT_EQ(ssSerializedSize(snapshot, SSDataFormat::F4), fineGrained.size());
+    }
+
+    // Other containers
+    const std::list<Item> list(snapshot.items.begin(), snapshot.items.end());
+    ASSERT_EQ(ssLoadRet<std::list<Item>>(ssSave(list, SSDataFormat::F4)), list);
+
+    // In-place load
+    std::vector<Item> target = makeItems(10);
+    ssLoadInPlace(ssSave(snapshot.items, SSParallelSave{2, 100}, SSDataFormat::F4), target);
+    ASSERT_EQ(target, snapshot.items);
+
+    // Views
+    const auto view = ssView<Snapshot>(fineGrained);
+    ASSERT_EQ(view.get<1>(), snapshot.items);
+    ASSERT_EQ(view.get<3>(), snapshot.fixed);
+    ASSERT_EQ(view.load(), snapshot);
+}
+
+TEST(SuitableStruct, IndexedContainers_ParallelLoad)
+{
+    const auto snapshot = makeSnapshot(10000);
+    const auto saved = ssSave(snapshot, SSParallelSave{4, 100}, SSDataFormat::F4);
+
+    ASSERT_EQ(ssLoadRet<Snapshot>(saved, SSParallelLoad{4}), snapshot);
+    ASSERT_EQ(ssLoadRet<Snapshot>(saved, SSParallelLoad{}), snapshot);
+    ASSERT_EQ(ssLoadRet<Snapshot>(saved, SSParallelLoad{1}), snapshot);
+
+    Snapshot loaded;
+    ssLoad(saved, loaded, SSParallelLoad{3});
+    ASSERT_EQ(loaded, snapshot);
+
+    // Other formats are loaded sequentially
+    ASSERT_EQ(ssLoadRet<Snapshot>(ssSave(snapshot, SSDataFormat::F3), SSParallelLoad{4}), snapshot);
+
+    // Nested containers
+    const std::vector<std::vector<Item>> nested(20, makeItems(300));
+    ASSERT_EQ(ssLoadRet<std::vector<std::vector<Item>>>(ssSave(nested, SSParallelSave{4, 7}, SSDataFormat::F4), SSParallelLoad{4}), nested);
+
+    // Memory resource
+    std::pmr::monotonic_buffer_resource resource;
+    const std::pmr::vector<std::pmr::string> strings(5000, std::pmr::string(100, 's'));
+    const auto pmrLoaded = ssLoadRet<std::pmr::vector<std::pmr::string>>(ssSave(strings, SSDataFormat::F4), &resource);
+    ASSERT_EQ(pmrLoaded, strings);
+}
+
+TEST(SuitableStruct, IndexedContainers_ParallelLoadMemoryResource)
+{
+    std::vector<std::pmr::vector<Probe>> groups(16, std::pmr::vector<Probe>(2));
+    for (size_t i = 0; i < groups.size(); i++)
+        groups[i].back().value = std::to_string(i);
+
+    const auto saved = ssSave(groups, SSParallelSave{1, 1}, SSDataFormat::F4);
+
+    // Arenas aren't thread-safe, so the load stays on the calling thread
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        Internal::MemoryResourceScope resourceScope(&arena);
+        Probe::threads.clear();
+
+        const auto result = ssLoadRet<std::vector<std::pmr::vector<Probe>>>(saved, SSParallelLoad{4});
+        ASSERT_EQ(result.size(), groups.size());
+        ASSERT_EQ(result.back().back().value, "15");
+        ASSERT_EQ(result.back().get_allocator().resource(), &arena);
+        ASSERT_EQ(Probe::threads, std::set<std::thread::id>{std::this_thread::get_id()});
+    }
+
+    // Synchronized resources are used by all threads
+    {
+        std::pmr::synchronized_pool_resource pool;
+        Internal::MemoryResourceScope resourceScope(&pool);
+        Probe::threads.clear();
+
+        const auto result = ssLoadRet<std::vector<std::pmr::vector<Probe>>>(saved, SSParallelLoad{4});
+        ASSERT_EQ(result.back().back().value, "15");
+        ASSERT_EQ(result.front().get_allocator().resource(), &pool);
+        ASSERT_EQ(result.back().get_allocator().resource(), &pool);
+        ASSERT_GT(Probe::threads.size(), 1u);
+    }
+}
+
+TEST(SuitableStruct, IndexedContainers_ParallelLoadThreads)
+{
+    std::vector<Probe> probes(16);
+    for (size_t i = 0; i < probes.size(); i++)
+        probes[i].value = std::to_string(i);
+
+    const auto saved = ssSave(probes, SSParallelSave{1, 1}, SSDataFormat::F4);
+    Probe::threads.clear();
+    ASSERT_EQ(ssLoadRet<std::vector<Probe>>(saved, SSParallelLoad{4}).back().value, "15");
+    ASSERT_GT(Probe::threads.size(), 1u);
+    ASSERT_LE(Probe::threads.size(), 4u);
+
+    // Exceptions of other threads are rethrown
+    Probe::throwOn = 13;
+    ASSERT_THROW((void)ssLoadRet<std::vector<Probe>>(saved, SSParallelLoad{4}), std::runtime_error);
+    Probe::throwOn = -1;
+}
+
+TEST(SuitableStruct, IndexedContainers_LoadItem)
+{
+    const auto items = makeItems(10000);
+
+    for (auto format : {SSDataFormat::F1, SSDataFormat::F3, SSDataFormat::F4}) {
+        const auto saved = ssSave(items, SSParallelSave{1, 100}, format);
+
+        for (size_t i : {0, 1, 99, 100, 101, 5555, 9999})
+            ASSERT_EQ(ssLoadItem<std::vector<Item>>(saved, i, SSLoadMode::ProtectedTrusted), items[i]);
+
+        ASSERT_EQ(ssLoadItem<std::vector<Item>>(saved, 42), items[42]);
+        ASSERT_THROW((void)ssLoadItem<std::vector<Item>>(saved, 10000), std::exception);
+    }
+
+    // Maps, fixed-sized & primitive items
+    const auto snapshot = makeSnapshot(1000);
+    const auto names = ssLoadItem<std::map<int, std::string>>(ssSave(snapshot.names, SSDataFormat::F4), 500);
+    ASSERT_EQ(names, std::make_pair(500, std::string("500")));
+
+    const std::vector<Point> points {{1, 2}, {3, 4}, {5, 6}};
+    ASSERT_EQ(ssLoadItem<std::vector<Point>>(ssSave(points, SSDataFormat::F4), 2), (Point{5, 6}));
+    ASSERT_EQ(ssLoadItem<std::vector<Point>>(ssSave(points, SSDataFormat::F3), 1), (Point{3, 4}));
+    ASSERT_EQ(ssLoadItem<std::vector<int>>(ssSave(std::vector<int>{7, 8, 9}), 1), 8);
+
+    // Non-protected data, reader is moved past the container
+    Buffer buffer = ssSave(items, false) + ssSave(5, false);
+    BufferReader reader(buffer);
+    ASSERT_EQ(ssLoadItem<std::vector<Item>>(reader, 7, SSLoadMode::NonProtectedF1Hint), items[7]);
+    ASSERT_EQ(ssLoadRet<int>(reader, SSLoadMode::NonProtectedF1Hint), 5);
+}
+
+TEST(SuitableStruct, IndexedContainers_Corrupted)
+{
+    const auto items = makeItems(1000);
+    const auto saved = ssSave(items, SSParallelSave{1, 100}, SSDataFormat::F4);
+
+    // Items count, varint grain, index
+    const auto indexPos = Internal::SS_PROTECTED_HEADER_SIZE + Internal::SS_SINGLE_SEGMENT_FRAMING_SIZE + sizeof(uint64_t);
+    ASSERT_EQ(saved.cdata()[indexPos], 100);
+
+    auto patched = [&saved, indexPos](size_t chunk, uint64_t end) {
+        auto data = saved;
+        memcpy(data.data() + indexPos + 1 + chunk * sizeof(uint64_t), &end, sizeof(end));
+        return data;
+    };
+
+    uint64_t firstEnd {};
+    memcpy(&firstEnd, saved.cdata() + indexPos + 1, sizeof(firstEnd));
+
+    // Chunk boundaries are checked by validation & parallel load
+    for (const auto& bad : {patched(0, firstEnd + 1), patched(0, firstEnd - 1), patched(3, 0), patched(9, 1 << 30)}) {
+        ASSERT_FALSE(ssValidate<std::vector<Item>>(bad, SSLoadMode::ProtectedTrusted));
+        ASSERT_THROW((void)ssLoadRet<std::vector<Item>>(bad, SSParallelLoad{4}, SSLoadMode::ProtectedTrusted), std::exception);
+    }
+
+    // Order & total size, by any load
+    for (const auto& bad : {patched(3, 0), patched(9, firstEnd * 10 - 1), patched(9, 1 << 30)})
+        ASSERT_THROW((void)ssLoadRet<std::vector<Item>>(bad, SSLoadMode::ProtectedTrusted), std::exception);
+
+    ASSERT_TRUE(ssValidate<std::vector<Item>>(patched(0, firstEnd)));
+}